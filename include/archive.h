@@ -0,0 +1,9 @@
+#include <types.h>
+
+Archive *Archive_init(Input *in);
+
+void Archive_free(Archive *archive);
+
+short Archive_detect(Input *in);
+
+int Archive_rewrite(Archive *archive, State *state);
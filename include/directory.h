@@ -0,0 +1,5 @@
+#include <types.h>
+
+short is_directory(const char *path);
+
+void fix_directory(State *state);
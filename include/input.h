@@ -0,0 +1,9 @@
+#include <types.h>
+
+Input *Input_init(int fd);
+
+void Input_free(Input *in);
+
+ssize_t Input_read(Input *in, char *dest, size_t len);
+
+char *Input_load(const char *path, size_t *size, short *mapped);
@@ -0,0 +1,18 @@
+#include <types.h>
+
+Journal *Journal_init(const char *output, struct stat *in_stat);
+
+void Journal_free(Journal *journal, short done);
+
+void Journal_hash(Journal *journal, const char *data, size_t len);
+
+int Journal_load(Journal *journal);
+
+int Journal_verify(Journal *journal, int fd);
+
+int Journal_save(Journal *journal, int out_fd, size_t in_offset, size_t out_offset, short copy);
+
+int Journal_load_shift(Journal *journal);
+
+int Journal_save_shift(Journal *journal, size_t in_offset, size_t out_offset, short copy, short long_line,
+                       const char *backup, size_t backup_len);
@@ -3,3 +3,8 @@
 Lexer *Lexer_init(char *file_path);
 void Lexer_free(Lexer *tokenizer);
 int Lexer_tokenize(Lexer *lexer);
+LexerToken Lexer_token(const Lexer *lexer, size_t index);
+const char *LexerToken_text(const Lexer *lexer, const LexerToken *token);
+short LexerToken_equals(const Lexer *lexer, const LexerToken *token, const char *str);
+short LexerToken_iequals(const Lexer *lexer, const LexerToken *token, const char *str);
+wchar_t *LexerToken_wcs(const Lexer *lexer, const LexerToken *token);
@@ -0,0 +1,12 @@
+#include <types.h>
+
+Matcher *Matcher_init(const MatchRule *rules, size_t len);
+
+void Matcher_free(Matcher *matcher);
+
+short Matcher_next(const Matcher *matcher, const char *data, size_t size, size_t from, short at_eof, short *copy,
+                   Match *match);
+
+short Matcher_copy_end(const Matcher *matcher, const char *data, size_t size, size_t from, short at_eof, size_t *end);
+
+short Matcher_copy_at(const Matcher *matcher, const char *data, size_t size, size_t from);
@@ -0,0 +1,15 @@
+#include <types.h>
+
+Output *Output_init(int fd, OutputFormat format, size_t workers);
+
+short Output_supports(OutputFormat format);
+
+void Output_free(Output *out);
+
+void Output_source(Output *out, int fd, const char *data, size_t size);
+
+int Output_write(Output *out, const char *data, size_t len);
+
+int Output_flush(Output *out);
+
+int Output_finish(Output *out);
@@ -0,0 +1,11 @@
+#include <types.h>
+
+Pool *Pool_init(size_t workers);
+
+void Pool_free(Pool *pool);
+
+void Pool_submit(Pool *pool, PoolTask *task);
+
+void Pool_wait(Pool *pool, PoolTask *task);
+
+size_t Pool_default_workers();
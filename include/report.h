@@ -0,0 +1,13 @@
+#include <types.h>
+
+Report *Report_init();
+
+void Report_free(Report *report);
+
+void Report_seek(Report *report, const char *at, size_t offset);
+
+void Report_move(Report *report, const char *end, const char *next);
+
+void Report_add(Report *report, size_t rule, const char *at);
+
+void Report_print(Report *report, const Matcher *matcher, const char *input, FILE *out);
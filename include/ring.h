@@ -0,0 +1,9 @@
+#include <types.h>
+
+Ring *Ring_init(size_t cap);
+
+void Ring_free(Ring *ring);
+
+short Ring_push(Ring *ring, void *item);
+
+short Ring_pop(Ring *ring, void **item);
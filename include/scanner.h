@@ -0,0 +1,11 @@
+#include <types.h>
+
+Scanner *Scanner_init(const char *bytes, size_t len);
+
+Scanner *Scanner_init_pair(char first, char second);
+
+void Scanner_free(Scanner *scanner);
+
+size_t Scanner_find(const Scanner *scanner, const char *data, size_t size);
+
+int Scanner_rank(unsigned char c);
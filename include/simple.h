@@ -1,3 +1,7 @@
 #include <types.h>
 
 void fix_content(State *state);
+
+size_t fix_string(State *state, char *str, size_t len, size_t offset);
+
+short fix_slice(State *state, Output *out, const char *data, size_t begin, size_t end, short copy);
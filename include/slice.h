@@ -0,0 +1,11 @@
+#include <types.h>
+
+Slice *Slice_init(const char *output, const char *input, struct stat *in_stat);
+
+void Slice_free(Slice *slice);
+
+int Slice_save(Slice *slice);
+
+Slice *Slice_load(const char *output);
+
+void merge_slices(State *state);
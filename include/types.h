@@ -6,6 +6,13 @@
 #include <wchar.h>
 #include <locale.h>
 #include <ctype.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <time.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
 
 typedef struct FilePosition_t {
     size_t line;
@@ -17,9 +24,110 @@ typedef enum Flag_e {
     FLAG_NoOp,
     FLAG_Input,
     FLAG_Output,
+    FLAG_Jobs,
+    FLAG_Range,
     FLAG_Help
 } Flag;
 
+typedef enum OutputFormat_e {
+    OutputFormat_Plain,
+    OutputFormat_Gzip,
+    OutputFormat_Zstd,
+} OutputFormat;
+
+#define SCANNER_BYTES_MAX 8
+
+typedef struct Scanner_t {
+    unsigned char bytes[SCANNER_BYTES_MAX];
+    size_t len;
+    unsigned char table[256];
+    size_t (*find)(const struct Scanner_t *scanner, const char *data, size_t size);
+} Scanner;
+
+typedef enum MatchKind_e {
+    MatchKind_Line,
+    MatchKind_Prefix,
+    MatchKind_Copy,
+} MatchKind;
+
+typedef struct MatchRule_t {
+    const char *name;
+    const char *pattern;
+    MatchKind kind;
+    size_t maxLen;
+} MatchRule;
+
+typedef struct Matcher_t {
+    const MatchRule *rules;
+    size_t ruleLen;
+    size_t *patternLens;
+    size_t *anchors;
+    Scanner *scanner;
+    Scanner *terminator;
+    size_t maxLine;
+} Matcher;
+
+typedef struct Match_t {
+    size_t rule;
+    size_t start;
+    size_t len;
+    size_t end;
+} Match;
+
+typedef struct ReportHit_t {
+    size_t rule;
+    size_t offset;
+    size_t line;
+} ReportHit;
+
+typedef struct Report_t {
+    ReportHit *hits;
+    size_t hitLen;
+    size_t hitCap;
+    const char *cursor;
+    size_t offset;
+    size_t line;
+    size_t scanned;
+    struct timespec started;
+} Report;
+
+typedef struct Journal_t {
+    char *path;
+    int fd;
+    uint64_t inSize;
+    uint64_t inMtimeSec;
+    uint64_t inMtimeNsec;
+    uint64_t inOffset;
+    uint64_t outOffset;
+    short copy;
+    uint64_t hash;
+    unsigned char pending[8];
+    size_t pendingLen;
+    uint64_t savedHash;
+    unsigned char savedPending[8];
+    size_t savedPendingLen;
+    uint64_t inDev;
+    uint64_t inIno;
+    uint64_t sequence;
+    short longLine;
+    char *backup;
+    size_t backupLen;
+    size_t backupCap;
+} Journal;
+
+typedef struct Slice_t {
+    char *path;
+    char *input;
+    uint64_t inSize;
+    uint64_t inMtimeSec;
+    uint64_t inMtimeNsec;
+    uint64_t begin;
+    uint64_t end;
+    short copyBegin;
+    short copyEnd;
+    uint64_t outSize;
+} Slice;
+
 typedef struct State_t {
     char *input;
     char *output;
@@ -27,8 +135,199 @@ typedef struct State_t {
     FILE *in;
     FILE *out;
     short dry;
+    char *staged;
+    size_t fixed;
+    OutputFormat compress;
+    size_t jobs;
+    short archive;
+    short link;
+    Matcher *matcher;
+    Report *report;
+    short resume;
+    Journal *journal;
+    short ranged;
+    size_t rangeStart;
+    size_t rangeLen;
+    short merge;
+    char **parts;
+    size_t partLen;
+    short stats;
+    short compressed;
+    short compact;
+    short uring;
 } State;
 
+typedef struct PoolTask_t {
+    void (*run)(void *arg);
+    void *arg;
+    short done;
+    struct PoolTask_t *next;
+} PoolTask;
+
+typedef struct Pool_t {
+    pthread_t *threads;
+    size_t threadLen;
+    pthread_mutex_t lock;
+    pthread_cond_t queued;
+    pthread_cond_t finished;
+    PoolTask *head;
+    PoolTask *tail;
+    short closed;
+} Pool;
+
+typedef struct DirectoryFile_t {
+    PoolTask task;
+    char *from;
+    char *to;
+    short link;
+    short failed;
+} DirectoryFile;
+
+typedef struct FixChunk_t {
+    PoolTask task;
+    const Matcher *matcher;
+    const char *data;
+    size_t size;
+    Match *matches;
+    size_t matchLen;
+    size_t matchCap;
+    size_t copyEnd;
+    short copyFound;
+    short copy;
+} FixChunk;
+
+typedef enum InputFormat_e {
+    InputFormat_Plain,
+    InputFormat_Gzip,
+    InputFormat_Zstd,
+    InputFormat_Lz4,
+} InputFormat;
+
+typedef struct Input_t {
+    int fd;
+    InputFormat format;
+    void *stream;
+    char *buffer;
+    size_t bufferLen;
+    size_t bufferPos;
+    short frameEnd;
+} Input;
+
+typedef struct OutputBlock_t {
+    PoolTask task;
+    OutputFormat format;
+    char *data;
+    size_t len;
+    char *packed;
+    size_t packedLen;
+    short failed;
+} OutputBlock;
+
+typedef struct Archive_t {
+    Input *in;
+    char *buffer;
+    size_t bufferLen;
+    size_t bufferPos;
+    char *toc;
+    size_t tocLen;
+    size_t tocCap;
+    size_t consumed;
+    int version;
+    unsigned char intSize;
+    unsigned char offSize;
+    unsigned char format;
+    size_t *offsets;
+    size_t offsetLen;
+} Archive;
+
+typedef struct Uring_t {
+    int fd;
+    unsigned entries;
+    unsigned queued;
+    void *ring;
+    size_t ringSize;
+    void *sqes;
+    size_t entrySize;
+    unsigned *sqHead;
+    unsigned *sqTail;
+    unsigned *sqMask;
+    unsigned *sqArray;
+    unsigned *cqHead;
+    unsigned *cqTail;
+    unsigned *cqMask;
+    void *cqes;
+} Uring;
+
+typedef struct Output_t {
+    int fd;
+    struct iovec *spans;
+    size_t spanLen;
+    size_t spanCap;
+    size_t written;
+    int source;
+    const char *sourceData;
+    size_t sourceSize;
+    short splice;
+    OutputFormat format;
+    Pool *pool;
+    OutputBlock *blocks;
+    size_t blockLen;
+    size_t head;
+    size_t inFlight;
+} Output;
+
+typedef struct RingBlock_t {
+    char *data;
+    off_t offset;
+    size_t want;
+    size_t filled;
+    short reading;
+    short writing;
+    Output *out;
+} RingBlock;
+
+typedef struct Ring_t {
+    void **items;
+    size_t cap;
+    _Atomic size_t head;
+    _Atomic size_t tail;
+} Ring;
+
+typedef enum PipeStage_e {
+    PipeStage_Read,
+    PipeStage_Scan,
+    PipeStage_Write,
+} PipeStage;
+
+typedef struct PipeBlock_t {
+    char *data;
+    char *buffer;
+    size_t len;
+    size_t size;
+    size_t tail;
+    short eof;
+    Output *spans;
+} PipeBlock;
+
+typedef struct Pipeline_t {
+    State *state;
+    Input *source;
+    Output *out;
+    PipeBlock *blocks;
+    size_t blockLen;
+    size_t carryCap;
+    Ring *empty;
+    Ring *filled;
+    Ring *scanned;
+    PipeBlock *held;
+    size_t carry;
+    short longLine;
+    short copy;
+    short done[3];
+    short waiting[3];
+    size_t stalls[3];
+} Pipeline;
+
 typedef enum ParserError_e {
     ParserError_Valid,
     ParserError_AllocFailed,
@@ -79,29 +378,65 @@ typedef enum ParserType_e {
 
 typedef struct LexerToken_t {
     LexerType type;
-    wchar_t *str;
+    size_t offset;
+    size_t len;
     FilePosition position;
 } LexerToken;
 
+#define LEXER_TOKEN_BLOCK 256
+
+typedef struct LexerWideToken_t {
+    size_t index;
+    LexerToken token;
+} LexerWideToken;
+
+/**
+ * Tokens as parallel arrays. Offsets, lines and positions are relative to
+ * the first token of each LEXER_TOKEN_BLOCK tokens, token with a field not
+ * fitting 32 bits is kept whole in `wide` instead.
+ */
+typedef struct LexerTokens_t {
+    unsigned char *type;
+    uint32_t *offset;
+    uint32_t *len;
+    uint32_t *line;
+    uint32_t *character;
+    uint32_t *position;
+    size_t *offsetBase;
+    size_t *lineBase;
+    size_t *positionBase;
+    size_t cap;
+    LexerWideToken *wide;
+    size_t wideLen;
+    size_t wideCap;
+} LexerTokens;
+
 typedef struct ParserToken_t {
     struct ParserToken_t *left;
     struct ParserToken_t *right;
     wchar_t *str;
     ParserType type;
     FilePosition position;
-    LexerToken *lexerToken;
+    LexerToken lexerToken;
 } ParserToken;
 
 typedef struct Lexer_t {
-    FILE *in;
+    char *data;
+    size_t size;
+    short mapped;
+    size_t pos;
     FilePosition position;
-    LexerToken **tokens;
+    LexerTokens tokens;
     size_t tokenLen;
-    wchar_t *buffer;
+    size_t lexemeChars;
+    size_t lexemeStart;
+    size_t lexemeEnd;
+    size_t (*asciiPrefix)(const char *data, size_t size);
+    short failed;
 } Lexer;
 
 typedef struct Parser_t {
-    LexerToken **tokens;
+    const Lexer *lexer;
     ParserToken *ast;
     size_t tokenLen;
     size_t position;
@@ -0,0 +1,13 @@
+#include <types.h>
+
+Uring *Uring_init(unsigned entries);
+
+void Uring_free(Uring *ring);
+
+int Uring_read(Uring *ring, int fd, void *buffer, size_t len, off_t offset, unsigned long tag);
+
+int Uring_writev(Uring *ring, int fd, const struct iovec *spans, size_t len, off_t offset, unsigned long tag);
+
+int Uring_submit(Uring *ring);
+
+int Uring_wait(Uring *ring, unsigned long *tag, int *result);
@@ -0,0 +1,303 @@
+#include <archive.h>
+#include <input.h>
+#include <simple.h>
+
+/**
+ * pg_dump custom (-Fc) archive is header, TOC and data blocks. Only TOC is
+ * parsed, SEQUENCE definitions are fixed and everything after TOC is copied
+ * byte for byte. Data offsets stored in TOC are moved by the change of TOC size.
+ * Directory (-Fd) `toc.dat` has the same layout with file names in place of
+ * offsets and no data.
+ */
+
+static const char *ARCHIVE_MAGIC = "PGDMP";
+
+static const size_t ARCHIVE_BUFFER_SIZE = 1 << 16;
+
+static const unsigned char ARCHIVE_FORMAT_CUSTOM = 1;
+
+static const unsigned char ARCHIVE_FORMAT_DIRECTORY = 3;
+
+static const unsigned char ARCHIVE_OFFSET_SET = 2;
+
+#define ARCHIVE_VERSION(major, minor) (((major) * 256 + (minor)) * 256)
+
+static int read_raw(Archive *archive, char *dest, size_t len);
+
+static int read_byte(Archive *archive, unsigned char *value, short emit);
+
+static int read_int(Archive *archive, long *value, short emit);
+
+static int read_str(Archive *archive, char **value, long *len, short emit);
+
+static int read_header(Archive *archive);
+
+static int read_entry(Archive *archive, State *state);
+
+static int read_extra(Archive *archive);
+
+static void append(Archive *archive, const char *data, size_t len);
+
+static void append_int(Archive *archive, long value);
+
+static void move_offsets(Archive *archive, long delta);
+
+Archive *Archive_init(Input *in) {
+    Archive *archive = (Archive *) malloc(sizeof(Archive));
+    memset(archive, 0, sizeof(Archive));
+    archive->in = in;
+    archive->buffer = (char *) malloc(ARCHIVE_BUFFER_SIZE);
+    return archive;
+}
+
+void Archive_free(Archive *archive) {
+    if (archive == NULL)
+        return;
+    if (archive->buffer) free(archive->buffer);
+    if (archive->toc) free(archive->toc);
+    if (archive->offsets) free(archive->offsets);
+    free(archive);
+}
+
+/**
+ * Check for archive magic in bytes already peeked by `Input_init`.
+ */
+short Archive_detect(Input *in) {
+    size_t len = strlen(ARCHIVE_MAGIC);
+    return in->format == InputFormat_Plain && in->bufferLen >= len && memcmp(in->buffer, ARCHIVE_MAGIC, len) == 0;
+}
+
+/**
+ * Read header and TOC, collecting rewritten copy of both in `toc`. Returns -1
+ * for truncated or unsupported archive. Bytes following TOC are left in
+ * `buffer` starting at `bufferPos` and in the input.
+ */
+int Archive_rewrite(Archive *archive, State *state) {
+    if (read_header(archive) != 0)
+        return -1;
+
+    long count = 0;
+    if (read_int(archive, &count, 1) != 0 || count < 0)
+        return -1;
+    for (long i = 0; i < count; i++) {
+        if (read_entry(archive, state) != 0)
+            return -1;
+    }
+
+    move_offsets(archive, (long) archive->tocLen - (long) archive->consumed);
+    return 0;
+}
+
+static int read_header(Archive *archive) {
+    char magic[5];
+    unsigned char major, minor, revision, format;
+    if (read_raw(archive, magic, sizeof(magic)) != 0 || memcmp(magic, ARCHIVE_MAGIC, sizeof(magic)) != 0)
+        return -1;
+    append(archive, magic, sizeof(magic));
+
+    if (read_byte(archive, &major, 1) != 0 || read_byte(archive, &minor, 1) != 0 ||
+        read_byte(archive, &revision, 1) != 0 || read_byte(archive, &archive->intSize, 1) != 0 ||
+        read_byte(archive, &archive->offSize, 1) != 0 || read_byte(archive, &format, 1) != 0)
+        return -1;
+    archive->version = (major * 256 + minor) * 256 + revision;
+    archive->format = format;
+    if (archive->version < ARCHIVE_VERSION(1, 10) ||
+        (archive->format != ARCHIVE_FORMAT_CUSTOM && archive->format != ARCHIVE_FORMAT_DIRECTORY))
+        return -1;
+    if (archive->intSize == 0 || archive->intSize > sizeof(long) || archive->offSize > sizeof(long))
+        return -1;
+
+    long value = 0;
+    unsigned char compression;
+    if (archive->version >= ARCHIVE_VERSION(1, 15)) {
+        if (read_byte(archive, &compression, 1) != 0)
+            return -1;
+    } else if (read_int(archive, &value, 1) != 0) {
+        return -1;
+    }
+
+    // creation time: sec, min, hour, day, month, year, dst
+    for (int i = 0; i < 7; i++) {
+        if (read_int(archive, &value, 1) != 0)
+            return -1;
+    }
+    // database name, server version and pg_dump version
+    for (int i = 0; i < 3; i++) {
+        if (read_str(archive, NULL, NULL, 1) != 0)
+            return -1;
+    }
+    return 0;
+}
+
+static int read_entry(Archive *archive, State *state) {
+    long value = 0;
+    long len = 0;
+    char *desc = NULL;
+    char *defn = NULL;
+
+    // dump id, had dumper, table oid, oid, tag
+    if (read_int(archive, &value, 1) != 0 || read_int(archive, &value, 1) != 0 ||
+        read_str(archive, NULL, NULL, 1) != 0 || read_str(archive, NULL, NULL, 1) != 0 ||
+        read_str(archive, NULL, NULL, 1) != 0)
+        return -1;
+    if (read_str(archive, &desc, NULL, 1) != 0)
+        return -1;
+    if (archive->version >= ARCHIVE_VERSION(1, 11) && read_int(archive, &value, 1) != 0) {
+        free(desc);
+        return -1;
+    }
+
+    if (read_str(archive, &defn, &len, 0) != 0) {
+        free(desc);
+        return -1;
+    }
+    if (defn && desc && strcmp(desc, "SEQUENCE") == 0)
+        len = (long) fix_string(state, defn, (size_t) len, archive->consumed - (size_t) len);
+    append_int(archive, len);
+    if (defn) append(archive, defn, (size_t) len);
+    free(defn);
+    free(desc);
+
+    // drop statement, copy statement, namespace, tablespace
+    for (int i = 0; i < 4; i++) {
+        if (read_str(archive, NULL, NULL, 1) != 0)
+            return -1;
+    }
+    if (archive->version >= ARCHIVE_VERSION(1, 14) && read_str(archive, NULL, NULL, 1) != 0)
+        return -1;
+    if (archive->version >= ARCHIVE_VERSION(1, 16) && read_int(archive, &value, 1) != 0)
+        return -1;
+    // owner, with oids
+    if (read_str(archive, NULL, NULL, 1) != 0 || read_str(archive, NULL, NULL, 1) != 0)
+        return -1;
+
+    // dependencies end with null string
+    do {
+        if (read_str(archive, NULL, &len, 1) != 0)
+            return -1;
+    } while (len >= 0);
+
+    return read_extra(archive);
+}
+
+/**
+ * Custom format stores data position flag followed by `offSize` bytes,
+ * position of set ones is remembered to be moved once new TOC size is known.
+ * Directory format stores name of data file.
+ */
+static int read_extra(Archive *archive) {
+    if (archive->format == ARCHIVE_FORMAT_DIRECTORY)
+        return read_str(archive, NULL, NULL, 1);
+
+    unsigned char flag;
+    char value[sizeof(long)];
+    if (read_byte(archive, &flag, 1) != 0 || read_raw(archive, value, archive->offSize) != 0)
+        return -1;
+    if (flag == ARCHIVE_OFFSET_SET) {
+        archive->offsets = (size_t *) realloc(archive->offsets, sizeof(size_t) * (archive->offsetLen + 1));
+        archive->offsets[archive->offsetLen] = archive->tocLen;
+        archive->offsetLen += 1;
+    }
+    append(archive, value, archive->offSize);
+    return 0;
+}
+
+static void move_offsets(Archive *archive, long delta) {
+    for (size_t i = 0; i < archive->offsetLen && delta != 0; i++) {
+        unsigned char *bytes = (unsigned char *) archive->toc + archive->offsets[i];
+        unsigned long value = 0;
+        for (size_t b = 0; b < archive->offSize; b++)
+            value |= (unsigned long) bytes[b] << (8 * b);
+        value += (unsigned long) delta;
+        for (size_t b = 0; b < archive->offSize; b++)
+            bytes[b] = (unsigned char) (value >> (8 * b));
+    }
+}
+
+static int read_raw(Archive *archive, char *dest, size_t len) {
+    while (len > 0) {
+        if (archive->bufferPos == archive->bufferLen) {
+            ssize_t n = Input_read(archive->in, archive->buffer, ARCHIVE_BUFFER_SIZE);
+            if (n <= 0)
+                return -1;
+            archive->bufferPos = 0;
+            archive->bufferLen = (size_t) n;
+        }
+        size_t n = archive->bufferLen - archive->bufferPos;
+        if (n > len) n = len;
+        memcpy(dest, archive->buffer + archive->bufferPos, n);
+        archive->bufferPos += n;
+        archive->consumed += n;
+        dest += n;
+        len -= n;
+    }
+    return 0;
+}
+
+static int read_byte(Archive *archive, unsigned char *value, short emit) {
+    if (read_raw(archive, (char *) value, 1) != 0)
+        return -1;
+    if (emit) append(archive, (char *) value, 1);
+    return 0;
+}
+
+/**
+ * Sign byte followed by `intSize` bytes, least significant first.
+ */
+static int read_int(Archive *archive, long *value, short emit) {
+    unsigned char bytes[1 + sizeof(long)];
+    if (read_raw(archive, (char *) bytes, 1 + archive->intSize) != 0)
+        return -1;
+    if (emit) append(archive, (char *) bytes, 1 + archive->intSize);
+
+    unsigned long result = 0;
+    for (size_t b = 0; b < archive->intSize; b++)
+        result |= (unsigned long) bytes[1 + b] << (8 * b);
+    *value = bytes[0] ? -(long) result : (long) result;
+    return 0;
+}
+
+/**
+ * Length prefixed string, -1 length stands for null. Copy is returned in
+ * `value` only when asked for.
+ */
+static int read_str(Archive *archive, char **value, long *len, short emit) {
+    long str_len = 0;
+    if (read_int(archive, &str_len, emit) != 0)
+        return -1;
+    if (len) *len = str_len;
+    if (value) *value = NULL;
+    if (str_len <= 0) {
+        if (value && str_len == 0) *value = (char *) calloc(1, 1);
+        return 0;
+    }
+
+    char *str = (char *) malloc((size_t) str_len + 1);
+    if (read_raw(archive, str, (size_t) str_len) != 0) {
+        free(str);
+        return -1;
+    }
+    str[str_len] = 0;
+    if (emit) append(archive, str, (size_t) str_len);
+    if (value) *value = str;
+    else free(str);
+    return 0;
+}
+
+static void append(Archive *archive, const char *data, size_t len) {
+    if (archive->tocLen + len > archive->tocCap) {
+        archive->tocCap = (archive->tocLen + len) * 2;
+        archive->toc = (char *) realloc(archive->toc, archive->tocCap);
+    }
+    memcpy(archive->toc + archive->tocLen, data, len);
+    archive->tocLen += len;
+}
+
+static void append_int(Archive *archive, long value) {
+    unsigned char bytes[1 + sizeof(long)];
+    unsigned long magnitude = value < 0 ? (unsigned long) -value : (unsigned long) value;
+    bytes[0] = value < 0 ? 1 : 0;
+    for (size_t b = 0; b < archive->intSize; b++)
+        bytes[1 + b] = (unsigned char) (magnitude >> (8 * b));
+    append(archive, (char *) bytes, 1 + archive->intSize);
+}
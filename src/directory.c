@@ -0,0 +1,229 @@
+#define _GNU_SOURCE
+
+#include <directory.h>
+#include <simple.h>
+#include <pool.h>
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <linux/fs.h>
+
+static const char *TOC_FILE = "toc.dat";
+
+static const size_t COPY_BLOCK_SIZE = 1 << 20;
+
+static char *join_path(const char *dir, const char *name);
+
+static void fix_toc(State *state, short in_place);
+
+static size_t list_files(State *state, DirectoryFile **files);
+
+static void copy_file(void *arg);
+
+static int copy_range(int from, int to, off_t size);
+
+static int copy_blocks(int from, int to);
+
+short is_directory(const char *path) {
+    struct stat path_stat;
+    return stat(path, &path_stat) == 0 && S_ISDIR(path_stat.st_mode);
+}
+
+/**
+ * Directory (-Fd) dump keeps every definition in `toc.dat`, only it is
+ * rewritten. Per-table data files never need a fix and are reflinked,
+ * hardlinked with `--link` or copied on worker pool.
+ */
+void fix_directory(State *state) {
+    struct stat in_stat;
+    struct stat out_stat;
+    stat(state->input, &in_stat);
+    short in_place = stat(state->output, &out_stat) == 0 &&
+                     out_stat.st_dev == in_stat.st_dev && out_stat.st_ino == in_stat.st_ino;
+
+    if (!in_place && state->dry == 0 && mkdir(state->output, 0700) != 0 &&
+        (errno != EEXIST || !is_directory(state->output))) {
+        fprintf(stderr, "Cannot open file to write: %s\n", state->output);
+        exit(1);
+    }
+    fix_toc(state, in_place);
+    if (in_place || state->dry)
+        return;
+
+    DirectoryFile *files = NULL;
+    size_t len = list_files(state, &files);
+    Pool *pool = Pool_init(state->jobs);
+    for (size_t i = 0; i < len; i++)
+        Pool_submit(pool, &files[i].task);
+
+    short failed = 0;
+    for (size_t i = 0; i < len; i++) {
+        Pool_wait(pool, &files[i].task);
+        if (files[i].failed) {
+            fprintf(stderr, "Cannot write to file: %s\n", files[i].to);
+            failed = 1;
+        }
+        free(files[i].from);
+        free(files[i].to);
+    }
+    Pool_free(pool);
+    free(files);
+    if (failed)
+        exit(1);
+}
+
+/**
+ * Rewrite `toc.dat` as standalone archive, in place it's staged and renamed
+ * like any other file.
+ */
+static void fix_toc(State *state, short in_place) {
+    State toc = *state;
+    toc.input = join_path(state->input, TOC_FILE);
+    toc.output = in_place ? strdup(toc.input) : join_path(state->output, TOC_FILE);
+    toc.out = NULL;
+    toc.staged = NULL;
+    toc.fixed = 0;
+    toc.compress = OutputFormat_Plain;
+    toc.resume = 0;
+    toc.in = fopen(toc.input, "r");
+    if (toc.in == NULL) {
+        fprintf(stderr, "File not found: %s\n", toc.input);
+        exit(1);
+    }
+
+    fix_content(&toc);
+    state->fixed += toc.fixed;
+    state->archive = toc.archive;
+    state->matcher = toc.matcher;
+
+    fclose(toc.in);
+    if (toc.out && fclose(toc.out) != 0) {
+        fprintf(stderr, "Cannot write to file: %s\n", toc.output);
+        exit(1);
+    }
+    free(toc.input);
+    free(toc.output);
+}
+
+/**
+ * Every regular file of dump except `toc.dat`.
+ */
+static size_t list_files(State *state, DirectoryFile **files) {
+    DIR *dir = opendir(state->input);
+    if (dir == NULL) {
+        fprintf(stderr, "Cannot read file: %s\n", state->input);
+        exit(1);
+    }
+
+    size_t len = 0;
+    size_t cap = 0;
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+        if (strcmp(entry->d_name, TOC_FILE) == 0)
+            continue;
+        char *from = join_path(state->input, entry->d_name);
+        struct stat file_stat;
+        if (stat(from, &file_stat) != 0 || !S_ISREG(file_stat.st_mode)) {
+            free(from);
+            continue;
+        }
+
+        if (len == cap) {
+            cap = cap ? cap * 2 : 64;
+            *files = (DirectoryFile *) realloc(*files, sizeof(DirectoryFile) * cap);
+        }
+        DirectoryFile *file = &(*files)[len++];
+        memset(file, 0, sizeof(DirectoryFile));
+        file->from = from;
+        file->to = join_path(state->output, entry->d_name);
+        file->link = state->link;
+        file->task.run = copy_file;
+        file->task.arg = file;
+    }
+    closedir(dir);
+    return len;
+}
+
+/**
+ * Cheapest way to get identical file: hardlink when asked for, reflink when
+ * file system can share extents, kernel side copy and plain copy otherwise.
+ */
+static void copy_file(void *arg) {
+    DirectoryFile *file = (DirectoryFile *) arg;
+    file->failed = 1;
+
+    if (file->link) {
+        unlink(file->to);
+        if (link(file->from, file->to) == 0) {
+            file->failed = 0;
+            return;
+        }
+    }
+
+    int from = open(file->from, O_RDONLY);
+    if (from < 0)
+        return;
+    struct stat from_stat;
+    int to = -1;
+    if (fstat(from, &from_stat) == 0)
+        to = open(file->to, O_WRONLY | O_CREAT | O_TRUNC, from_stat.st_mode & 07777);
+    if (to >= 0) {
+        if (ioctl(to, FICLONE, from) == 0 || copy_range(from, to, from_stat.st_size) == 0)
+            file->failed = 0;
+        if (close(to) != 0)
+            file->failed = 1;
+    }
+    close(from);
+}
+
+static int copy_range(int from, int to, off_t size) {
+    off_t done = 0;
+    while (done < size) {
+        ssize_t n = copy_file_range(from, NULL, to, NULL, (size_t) (size - done), 0);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n < 0 && done == 0 && (errno == ENOSYS || errno == EXDEV || errno == EINVAL || errno == EOPNOTSUPP))
+            return copy_blocks(from, to);
+        if (n <= 0)
+            return -1;
+        done += n;
+    }
+    return 0;
+}
+
+static int copy_blocks(int from, int to) {
+    char *buffer = (char *) malloc(COPY_BLOCK_SIZE);
+    int status = 0;
+    for (;;) {
+        ssize_t n = read(from, buffer, COPY_BLOCK_SIZE);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0) {
+            status = (int) n;
+            break;
+        }
+        ssize_t done = 0;
+        while (done < n) {
+            ssize_t written = write(to, buffer + done, (size_t) (n - done));
+            if (written < 0 && errno == EINTR)
+                continue;
+            if (written < 0) {
+                free(buffer);
+                return -1;
+            }
+            done += written;
+        }
+    }
+    free(buffer);
+    return status;
+}
+
+static char *join_path(const char *dir, const char *name) {
+    size_t len = strlen(dir) + strlen(name) + 2;
+    char *path = (char *) malloc(len);
+    snprintf(path, len, "%s/%s", dir, name);
+    return path;
+}
@@ -0,0 +1,351 @@
+#define _GNU_SOURCE
+
+#include <input.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#ifdef FIXPQ_WITH_ZLIB
+#include <zlib.h>
+#endif
+#ifdef FIXPQ_WITH_ZSTD
+#include <zstd.h>
+#endif
+#ifdef FIXPQ_WITH_LZ4
+#include <lz4frame.h>
+#endif
+
+static const size_t INPUT_BUFFER_SIZE = 1 << 20;
+
+// enough to recognise compression and pg_dump archive magic
+static const size_t INPUT_PEEK_SIZE = 8;
+
+static const unsigned char GZIP_MAGIC[] = {0x1f, 0x8b};
+static const unsigned char ZSTD_MAGIC[] = {0x28, 0xb5, 0x2f, 0xfd};
+static const unsigned char LZ4_MAGIC[] = {0x04, 0x22, 0x4d, 0x18};
+
+static ssize_t fill(Input *in);
+
+static InputFormat detect_format(Input *in);
+
+static short open_stream(Input *in);
+
+static ssize_t read_plain(Input *in, char *dest, size_t len);
+
+static ssize_t read_gzip(Input *in, char *dest, size_t len);
+
+static ssize_t read_zstd(Input *in, char *dest, size_t len);
+
+static ssize_t read_lz4(Input *in, char *dest, size_t len);
+
+/**
+ * Wrap `fd` and detect compression from first bytes. Returns NULL when input
+ * can't be read or is compressed with codec fixpq was built without.
+ */
+Input *Input_init(int fd) {
+    Input *in = (Input *) malloc(sizeof(Input));
+    memset(in, 0, sizeof(Input));
+    in->fd = fd;
+    in->buffer = (char *) malloc(INPUT_BUFFER_SIZE);
+    in->frameEnd = 1;
+
+    while (in->bufferLen < INPUT_PEEK_SIZE) {
+        ssize_t n = read(fd, in->buffer + in->bufferLen, INPUT_BUFFER_SIZE - in->bufferLen);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n < 0) {
+            Input_free(in);
+            return NULL;
+        }
+        if (n == 0)
+            break;
+        in->bufferLen += (size_t) n;
+    }
+
+    in->format = detect_format(in);
+    if (!open_stream(in)) {
+        Input_free(in);
+        return NULL;
+    }
+    return in;
+}
+
+void Input_free(Input *in) {
+    if (in == NULL)
+        return;
+    if (in->stream) {
+        switch (in->format) {
+#ifdef FIXPQ_WITH_ZLIB
+            case InputFormat_Gzip:
+                inflateEnd((z_stream *) in->stream);
+                free(in->stream);
+                break;
+#endif
+#ifdef FIXPQ_WITH_ZSTD
+            case InputFormat_Zstd:
+                ZSTD_freeDStream((ZSTD_DStream *) in->stream);
+                break;
+#endif
+#ifdef FIXPQ_WITH_LZ4
+            case InputFormat_Lz4:
+                LZ4F_freeDecompressionContext((LZ4F_dctx *) in->stream);
+                break;
+#endif
+            default:
+                break;
+        }
+    }
+    if (in->buffer) free(in->buffer);
+    free(in);
+}
+
+/**
+ * Read up to `len` decompressed bytes. Returns as soon as anything is
+ * decoded so streamed input is passed on without waiting for full buffer.
+ * Returns 0 at the end of input and -1 on read error or corrupted data.
+ */
+ssize_t Input_read(Input *in, char *dest, size_t len) {
+    switch (in->format) {
+        case InputFormat_Gzip:
+            return read_gzip(in, dest, len);
+        case InputFormat_Zstd:
+            return read_zstd(in, dest, len);
+        case InputFormat_Lz4:
+            return read_lz4(in, dest, len);
+        default:
+            return read_plain(in, dest, len);
+    }
+}
+
+/**
+ * Whole content of file for lexer, which keeps spans of it as tokens. Plain
+ * file is mapped, compressed one is decompressed into `malloc`ed buffer,
+ * `mapped` tells which one to release. Returns NULL when it can't be read,
+ * empty file gives empty buffer.
+ */
+char *Input_load(const char *path, size_t *size, short *mapped) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return NULL;
+    Input *in = Input_init(fd);
+    struct stat in_stat;
+    if (in == NULL || fstat(fd, &in_stat) != 0) {
+        Input_free(in);
+        close(fd);
+        return NULL;
+    }
+
+    char *data = NULL;
+    *size = 0;
+    *mapped = 0;
+    if (in->format == InputFormat_Plain && S_ISREG(in_stat.st_mode) && in_stat.st_size > 0) {
+        data = mmap(NULL, (size_t) in_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED) {
+            madvise(data, (size_t) in_stat.st_size, MADV_SEQUENTIAL);
+            *size = (size_t) in_stat.st_size;
+            *mapped = 1;
+            Input_free(in);
+            close(fd);
+            return data;
+        }
+        data = NULL;
+    }
+
+    size_t cap = INPUT_BUFFER_SIZE;
+    data = (char *) malloc(cap);
+    ssize_t n;
+    while ((n = Input_read(in, data + *size, cap - *size)) > 0) {
+        *size += (size_t) n;
+        if (*size == cap) {
+            char *grown = (char *) realloc(data, cap * 2);
+            if (grown == NULL) {
+                n = -1;
+                break;
+            }
+            data = grown;
+            cap *= 2;
+        }
+    }
+    Input_free(in);
+    close(fd);
+    if (n < 0) {
+        free(data);
+        return NULL;
+    }
+    return data;
+}
+
+static InputFormat detect_format(Input *in) {
+    const unsigned char *b = (const unsigned char *) in->buffer;
+    if (in->bufferLen >= sizeof(GZIP_MAGIC) && memcmp(b, GZIP_MAGIC, sizeof(GZIP_MAGIC)) == 0)
+        return InputFormat_Gzip;
+    if (in->bufferLen >= sizeof(ZSTD_MAGIC) && memcmp(b, ZSTD_MAGIC, sizeof(ZSTD_MAGIC)) == 0)
+        return InputFormat_Zstd;
+    if (in->bufferLen >= sizeof(LZ4_MAGIC) && memcmp(b, LZ4_MAGIC, sizeof(LZ4_MAGIC)) == 0)
+        return InputFormat_Lz4;
+    return InputFormat_Plain;
+}
+
+static short open_stream(Input *in) {
+    switch (in->format) {
+        case InputFormat_Plain:
+            return 1;
+        case InputFormat_Gzip: {
+#ifdef FIXPQ_WITH_ZLIB
+            z_stream *z = (z_stream *) malloc(sizeof(z_stream));
+            memset(z, 0, sizeof(z_stream));
+            in->stream = z;
+            return inflateInit2(z, 15 + 16) == Z_OK;
+#else
+            fprintf(stderr, "Input is gzip compressed but fixpq was built without zlib\n");
+            return 0;
+#endif
+        }
+        case InputFormat_Zstd: {
+#ifdef FIXPQ_WITH_ZSTD
+            in->stream = ZSTD_createDStream();
+            return in->stream != NULL;
+#else
+            fprintf(stderr, "Input is zstd compressed but fixpq was built without zstd\n");
+            return 0;
+#endif
+        }
+        case InputFormat_Lz4: {
+#ifdef FIXPQ_WITH_LZ4
+            LZ4F_dctx *dctx = NULL;
+            if (LZ4F_isError(LZ4F_createDecompressionContext(&dctx, LZ4F_VERSION)))
+                return 0;
+            in->stream = dctx;
+            return 1;
+#else
+            fprintf(stderr, "Input is lz4 compressed but fixpq was built without lz4\n");
+            return 0;
+#endif
+        }
+    }
+    return 0;
+}
+
+/**
+ * Refill compressed buffer once it's drained. Returns number of new bytes,
+ * 0 at the end of file.
+ */
+static ssize_t fill(Input *in) {
+    if (in->bufferPos < in->bufferLen)
+        return (ssize_t) (in->bufferLen - in->bufferPos);
+    for (;;) {
+        ssize_t n = read(in->fd, in->buffer, INPUT_BUFFER_SIZE);
+        if (n < 0 && errno == EINTR)
+            continue;
+        in->bufferPos = 0;
+        in->bufferLen = n > 0 ? (size_t) n : 0;
+        return n;
+    }
+}
+
+static ssize_t read_plain(Input *in, char *dest, size_t len) {
+    if (in->bufferPos < in->bufferLen) {
+        size_t n = in->bufferLen - in->bufferPos;
+        if (n > len) n = len;
+        memcpy(dest, in->buffer + in->bufferPos, n);
+        in->bufferPos += n;
+        return (ssize_t) n;
+    }
+    for (;;) {
+        ssize_t n = read(in->fd, dest, len);
+        if (n < 0 && errno == EINTR)
+            continue;
+        return n;
+    }
+}
+
+static ssize_t read_gzip(Input *in, char *dest, size_t len) {
+#ifdef FIXPQ_WITH_ZLIB
+    z_stream *z = (z_stream *) in->stream;
+    z->next_out = (Bytef *) dest;
+    z->avail_out = (uInt) len;
+
+    for (;;) {
+        size_t available = in->bufferLen - in->bufferPos;
+        z->next_in = (Bytef *) in->buffer + in->bufferPos;
+        z->avail_in = (uInt) available;
+        int status = inflate(z, Z_NO_FLUSH);
+        in->bufferPos = in->bufferLen - z->avail_in;
+        if (available > z->avail_in) in->frameEnd = 0;
+
+        if (status == Z_STREAM_END) {
+            // concatenated members are valid gzip stream
+            inflateReset(z);
+            in->frameEnd = 1;
+        } else if (status != Z_OK && status != Z_BUF_ERROR) {
+            return -1;
+        }
+        if (z->avail_out < len)
+            return (ssize_t) (len - z->avail_out);
+        if (in->bufferPos < in->bufferLen && status != Z_BUF_ERROR)
+            continue;
+
+        ssize_t n = fill(in);
+        if (n <= 0)
+            return n < 0 || !in->frameEnd ? -1 : 0;
+    }
+#else
+    return -1;
+#endif
+}
+
+static ssize_t read_zstd(Input *in, char *dest, size_t len) {
+#ifdef FIXPQ_WITH_ZSTD
+    ZSTD_outBuffer out = {dest, len, 0};
+
+    for (;;) {
+        ZSTD_inBuffer src = {in->buffer + in->bufferPos, in->bufferLen - in->bufferPos, 0};
+        size_t status = ZSTD_decompressStream((ZSTD_DStream *) in->stream, &out, &src);
+        in->bufferPos += src.pos;
+        if (ZSTD_isError(status))
+            return -1;
+        if (src.pos > 0 || out.pos > 0)
+            in->frameEnd = status == 0;
+
+        if (out.pos > 0)
+            return (ssize_t) out.pos;
+        if (src.pos > 0 && in->bufferPos < in->bufferLen)
+            continue;
+
+        ssize_t n = fill(in);
+        if (n <= 0)
+            return n < 0 || !in->frameEnd ? -1 : 0;
+    }
+#else
+    return -1;
+#endif
+}
+
+static ssize_t read_lz4(Input *in, char *dest, size_t len) {
+#ifdef FIXPQ_WITH_LZ4
+    for (;;) {
+        size_t dest_len = len;
+        size_t src_len = in->bufferLen - in->bufferPos;
+        size_t status = LZ4F_decompress((LZ4F_dctx *) in->stream, dest, &dest_len,
+                                        in->buffer + in->bufferPos, &src_len, NULL);
+        in->bufferPos += src_len;
+        if (LZ4F_isError(status))
+            return -1;
+        if (src_len > 0 || dest_len > 0)
+            in->frameEnd = status == 0;
+
+        if (dest_len > 0)
+            return (ssize_t) dest_len;
+        if (src_len > 0 && in->bufferPos < in->bufferLen)
+            continue;
+
+        ssize_t n = fill(in);
+        if (n <= 0)
+            return n < 0 || !in->frameEnd ? -1 : 0;
+    }
+#else
+    return -1;
+#endif
+}
@@ -0,0 +1,302 @@
+#include <journal.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+/**
+ * Checkpoint of conversion kept next to output as `<output>.journal`. Single
+ * record holds input and output offsets, COPY state of matcher and running
+ * hash of output written so far. Output is synced before record is written
+ * over the previous one and synced too, so record never claims more output
+ * than is on disk.
+ */
+
+static const char *JOURNAL_SUFFIX = ".journal";
+
+static const uint64_t JOURNAL_MAGIC = 0x314c4e524a515046; // "FPQJRNL1"
+
+static const uint64_t SHIFT_MAGIC = 0x3154464853515046; // "FPQSHFT1"
+
+static const uint64_t HASH_SEED = 0xcbf29ce484222325;
+
+static const uint64_t HASH_PRIME = 0x9e3779b97f4a7c15;
+
+// magic, input size, mtime sec and nsec, offsets, copy, hash, pending, pending length, checksum
+#define JOURNAL_FIELDS 11
+
+// magic, sequence, device, inode, input size, offsets, copy, long line, backup length and hash, checksum
+#define SHIFT_FIELDS 12
+
+static const size_t VERIFY_BLOCK_SIZE = 1 << 20;
+
+static uint64_t mix(uint64_t hash, uint64_t word);
+
+static void fill_record(Journal *journal, uint64_t *record);
+
+static uint64_t hash_bytes(const char *data, size_t len);
+
+static int load_slot(Journal *journal, int fd, size_t slot, uint64_t *record, char *backup);
+
+Journal *Journal_init(const char *output, struct stat *in_stat) {
+    Journal *journal = (Journal *) malloc(sizeof(Journal));
+    memset(journal, 0, sizeof(Journal));
+    size_t len = strlen(output) + strlen(JOURNAL_SUFFIX) + 1;
+    journal->path = (char *) malloc(len);
+    snprintf(journal->path, len, "%s%s", output, JOURNAL_SUFFIX);
+    journal->fd = -1;
+    journal->hash = HASH_SEED;
+    journal->inSize = (uint64_t) in_stat->st_size;
+    journal->inMtimeSec = (uint64_t) in_stat->st_mtim.tv_sec;
+    journal->inMtimeNsec = (uint64_t) in_stat->st_mtim.tv_nsec;
+    journal->inDev = (uint64_t) in_stat->st_dev;
+    journal->inIno = (uint64_t) in_stat->st_ino;
+    return journal;
+}
+
+/**
+ * Journal of finished conversion is removed.
+ */
+void Journal_free(Journal *journal, short done) {
+    if (journal == NULL)
+        return;
+    if (journal->fd >= 0) close(journal->fd);
+    if (done) unlink(journal->path);
+    free(journal->backup);
+    free(journal->path);
+    free(journal);
+}
+
+/**
+ * Hash is computed over 8 byte words of output stream, bytes of incomplete
+ * word wait in `pending` so result doesn't depend on how output is split.
+ */
+void Journal_hash(Journal *journal, const char *data, size_t len) {
+    while (len > 0 && journal->pendingLen > 0) {
+        journal->pending[journal->pendingLen++] = (unsigned char) *data++;
+        len -= 1;
+        if (journal->pendingLen == sizeof(uint64_t)) {
+            uint64_t word;
+            memcpy(&word, journal->pending, sizeof(word));
+            journal->hash = mix(journal->hash, word);
+            journal->pendingLen = 0;
+        }
+    }
+    for (; len >= sizeof(uint64_t); data += sizeof(uint64_t), len -= sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, data, sizeof(word));
+        journal->hash = mix(journal->hash, word);
+    }
+    memcpy(journal->pending + journal->pendingLen, data, len);
+    journal->pendingLen += len;
+}
+
+/**
+ * Read last checkpoint. Returns -1 when there is none, it's damaged or was
+ * made for input of different size or modification time.
+ */
+int Journal_load(Journal *journal) {
+    uint64_t record[JOURNAL_FIELDS];
+    int fd = open(journal->path, O_RDONLY);
+    if (fd < 0)
+        return -1;
+    ssize_t n = pread(fd, record, sizeof(record), 0);
+    close(fd);
+    if (n != (ssize_t) sizeof(record) || record[0] != JOURNAL_MAGIC || record[1] != journal->inSize ||
+        record[2] != journal->inMtimeSec || record[3] != journal->inMtimeNsec || record[9] >= sizeof(uint64_t))
+        return -1;
+
+    uint64_t checksum = HASH_SEED;
+    for (size_t i = 0; i + 1 < JOURNAL_FIELDS; i++)
+        checksum = mix(checksum, record[i]);
+    if (checksum != record[JOURNAL_FIELDS - 1] || record[4] > journal->inSize)
+        return -1;
+
+    journal->inOffset = record[4];
+    journal->outOffset = record[5];
+    journal->copy = (short) record[6];
+    journal->savedHash = record[7];
+    memcpy(journal->savedPending, &record[8], sizeof(uint64_t));
+    journal->savedPendingLen = (size_t) record[9];
+    return 0;
+}
+
+/**
+ * Hash first `outOffset` bytes of output `fd` and compare with loaded
+ * checkpoint, running hash continues from there when they match.
+ */
+int Journal_verify(Journal *journal, int fd) {
+    char *buffer = (char *) malloc(VERIFY_BLOCK_SIZE);
+    journal->hash = HASH_SEED;
+    journal->pendingLen = 0;
+
+    uint64_t offset = 0;
+    while (offset < journal->outOffset) {
+        size_t want = journal->outOffset - offset < VERIFY_BLOCK_SIZE ? journal->outOffset - offset : VERIFY_BLOCK_SIZE;
+        ssize_t n = pread(fd, buffer, want, (off_t) offset);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0) {
+            free(buffer);
+            return -1;
+        }
+        Journal_hash(journal, buffer, (size_t) n);
+        offset += (uint64_t) n;
+    }
+    free(buffer);
+
+    if (journal->hash != journal->savedHash || journal->pendingLen != journal->savedPendingLen ||
+        memcmp(journal->pending, journal->savedPending, journal->pendingLen) != 0)
+        return -1;
+    return 0;
+}
+
+/**
+ * Sync output and record that `in_offset` bytes of input produced
+ * `out_offset` bytes of it.
+ */
+int Journal_save(Journal *journal, int out_fd, size_t in_offset, size_t out_offset, short copy) {
+    if (fdatasync(out_fd) != 0)
+        return -1;
+    if (journal->fd < 0) {
+        journal->fd = open(journal->path, O_WRONLY | O_CREAT, 0600);
+        if (journal->fd < 0)
+            return -1;
+    }
+
+    uint64_t record[JOURNAL_FIELDS];
+    journal->inOffset = in_offset;
+    journal->outOffset = out_offset;
+    journal->copy = copy;
+    fill_record(journal, record);
+    if (pwrite(journal->fd, record, sizeof(record), 0) != (ssize_t) sizeof(record))
+        return -1;
+    return fdatasync(journal->fd);
+}
+
+/**
+ * Checkpoint of file compacted in place, see `Journal_save_shift`. Input
+ * size is taken from record as file may already be truncated, restored
+ * `backup` is left to the caller to write back.
+ */
+int Journal_load_shift(Journal *journal) {
+    int fd = open(journal->path, O_RDONLY);
+    if (fd < 0)
+        return -1;
+    uint64_t record[SHIFT_FIELDS];
+    char *backup = (char *) malloc(journal->backupCap + 1);
+    journal->sequence = 0;
+    for (size_t slot = 0; slot < 2; slot++) {
+        if (load_slot(journal, fd, slot, record, backup) != 0 || record[1] <= journal->sequence)
+            continue;
+        journal->sequence = record[1];
+        journal->inSize = record[4];
+        journal->inOffset = record[5];
+        journal->outOffset = record[6];
+        journal->copy = (short) record[7];
+        journal->longLine = (short) record[8];
+        journal->backupLen = (size_t) record[9];
+        char *loaded = journal->backup;
+        journal->backup = backup;
+        backup = loaded ? loaded : (char *) malloc(journal->backupCap + 1);
+    }
+    free(backup);
+    close(fd);
+    return journal->sequence > 0 ? 0 : -1;
+}
+
+/**
+ * Record that file compacted in place has its first `in_offset` bytes of
+ * input converted into first `out_offset` bytes of it. `backup` holds
+ * input following `in_offset` which the next write is going to overwrite.
+ * Records alternate between two slots each followed by room for
+ * `backupCap` bytes, so torn write leaves the previous one intact.
+ */
+int Journal_save_shift(Journal *journal, size_t in_offset, size_t out_offset, short copy, short long_line,
+                       const char *backup, size_t backup_len) {
+    if (journal->fd < 0) {
+        journal->fd = open(journal->path, O_WRONLY | O_CREAT | (journal->sequence == 0 ? O_TRUNC : 0), 0600);
+        if (journal->fd < 0)
+            return -1;
+    }
+    journal->sequence += 1;
+    uint64_t record[SHIFT_FIELDS];
+    memset(record, 0, sizeof(record));
+    record[0] = SHIFT_MAGIC;
+    record[1] = journal->sequence;
+    record[2] = journal->inDev;
+    record[3] = journal->inIno;
+    record[4] = journal->inSize;
+    record[5] = in_offset;
+    record[6] = out_offset;
+    record[7] = (uint64_t) copy;
+    record[8] = (uint64_t) long_line;
+    record[9] = backup_len;
+    record[10] = hash_bytes(backup, backup_len);
+    uint64_t checksum = HASH_SEED;
+    for (size_t i = 0; i + 1 < SHIFT_FIELDS; i++)
+        checksum = mix(checksum, record[i]);
+    record[SHIFT_FIELDS - 1] = checksum;
+
+    off_t offset = (off_t) ((journal->sequence % 2) * (sizeof(record) + journal->backupCap));
+    if (backup_len > 0 &&
+        pwrite(journal->fd, backup, backup_len, offset + (off_t) sizeof(record)) != (ssize_t) backup_len)
+        return -1;
+    if (pwrite(journal->fd, record, sizeof(record), offset) != (ssize_t) sizeof(record))
+        return -1;
+    return fdatasync(journal->fd);
+}
+
+static uint64_t mix(uint64_t hash, uint64_t word) {
+    hash = (hash ^ word) * HASH_PRIME;
+    return hash ^ (hash >> 29);
+}
+
+static void fill_record(Journal *journal, uint64_t *record) {
+    memset(record, 0, sizeof(uint64_t) * JOURNAL_FIELDS);
+    record[0] = JOURNAL_MAGIC;
+    record[1] = journal->inSize;
+    record[2] = journal->inMtimeSec;
+    record[3] = journal->inMtimeNsec;
+    record[4] = journal->inOffset;
+    record[5] = journal->outOffset;
+    record[6] = (uint64_t) journal->copy;
+    record[7] = journal->hash;
+    memcpy(&record[8], journal->pending, journal->pendingLen);
+    record[9] = journal->pendingLen;
+
+    uint64_t checksum = HASH_SEED;
+    for (size_t i = 0; i + 1 < JOURNAL_FIELDS; i++)
+        checksum = mix(checksum, record[i]);
+    record[JOURNAL_FIELDS - 1] = checksum;
+}
+
+static uint64_t hash_bytes(const char *data, size_t len) {
+    uint64_t hash = HASH_SEED;
+    for (; len >= sizeof(uint64_t); data += sizeof(uint64_t), len -= sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, data, sizeof(word));
+        hash = mix(hash, word);
+    }
+    uint64_t word = 0;
+    if (len > 0) memcpy(&word, data, len);
+    return mix(hash, word);
+}
+
+static int load_slot(Journal *journal, int fd, size_t slot, uint64_t *record, char *backup) {
+    off_t offset = (off_t) (slot * (sizeof(uint64_t) * SHIFT_FIELDS + journal->backupCap));
+    if (pread(fd, record, sizeof(uint64_t) * SHIFT_FIELDS, offset) != (ssize_t) (sizeof(uint64_t) * SHIFT_FIELDS) ||
+        record[0] != SHIFT_MAGIC || record[2] != journal->inDev || record[3] != journal->inIno ||
+        record[9] > journal->backupCap || record[5] > record[4] || record[6] > record[5])
+        return -1;
+
+    uint64_t checksum = HASH_SEED;
+    for (size_t i = 0; i + 1 < SHIFT_FIELDS; i++)
+        checksum = mix(checksum, record[i]);
+    if (checksum != record[SHIFT_FIELDS - 1])
+        return -1;
+
+    offset += (off_t) (sizeof(uint64_t) * SHIFT_FIELDS);
+    if (record[9] > 0 && pread(fd, backup, record[9], offset) != (ssize_t) record[9])
+        return -1;
+    return hash_bytes(backup, record[9]) == record[10] ? 0 : -1;
+}
@@ -1,10 +1,30 @@
 #include <types.h>
 #include <lexer.h>
+#include <input.h>
 #include <ctype.h>
+#include <strings.h>
+#include <sys/mman.h>
 
-static void LexerToken_free(LexerToken *token);
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define LEXER_X86
+#endif
 
-static short is_ok(Lexer *tokenizer);
+static int grow_tokens(LexerTokens *tokens, size_t cap);
+
+static void push_token(Lexer *lexer, const LexerToken *token);
+
+static size_t decode_utf8(const unsigned char *data, size_t size, wchar_t *c);
+
+static void take_character(Lexer *lexer, wchar_t c, size_t len);
+
+static size_t ascii_prefix_scalar(const char *data, size_t size);
+
+#ifdef LEXER_X86
+static size_t ascii_prefix_sse2(const char *data, size_t size);
+
+static size_t ascii_prefix_avx2(const char *data, size_t size);
+#endif
 
 static int is_keyword(Lexer *tokenizer);
 
@@ -16,23 +36,38 @@ static int is_separator(Lexer *tokenizer);
 
 static void consume(Lexer *lexer);
 
-static void store_character(Lexer *tokenizer, wchar_t c);
+static void store_character(Lexer *tokenizer, size_t len);
+
+#define LEXER_KEYWORD_MAX 32
 
-static const wchar_t **Lexer_KEYWORDS = NULL;
-static const size_t Lexer_KEYWORDS_SIZE = 760;
+// SQL dumps average 3 to 11 bytes per token, only a small part of that is
+// reserved up front and the stream doubles as it fills
+#define LEXER_BYTES_PER_TOKEN 64
+#define LEXER_TOKEN_RESERVE (1 << 16)
 
-static void init_keywords();
+#define LEXER_TOKEN_WIDE UINT32_MAX
 
 Lexer *Lexer_init(char *file_path) {
-    init_keywords();
     Lexer *tokenizer = (Lexer *) malloc(sizeof(Lexer));
     memset((void *) tokenizer, 0, sizeof(Lexer));
     tokenizer->position.character = 1;
-    tokenizer->in = fopen(file_path, "r");
-    if (tokenizer->in == NULL) {
+    tokenizer->asciiPrefix = ascii_prefix_scalar;
+#ifdef LEXER_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        tokenizer->asciiPrefix = ascii_prefix_avx2;
+    else if (__builtin_cpu_supports("sse2"))
+        tokenizer->asciiPrefix = ascii_prefix_sse2;
+#endif
+    tokenizer->data = Input_load(file_path, &tokenizer->size, &tokenizer->mapped);
+    if (tokenizer->data == NULL) {
         Lexer_free(tokenizer);
         return NULL;
     }
+    size_t reserve = tokenizer->size / LEXER_BYTES_PER_TOKEN;
+    if (reserve > LEXER_TOKEN_RESERVE) reserve = LEXER_TOKEN_RESERVE;
+    if (grow_tokens(&tokenizer->tokens, reserve + LEXER_TOKEN_BLOCK) != 0)
+        tokenizer->failed = 1;
     return tokenizer;
 }
 
@@ -40,159 +75,371 @@ void Lexer_free(Lexer *tokenizer) {
     if (tokenizer == NULL)
         return;
 
-    if (tokenizer->in) fclose(tokenizer->in);
-    if (tokenizer->buffer) free(tokenizer->buffer);
-    if (tokenizer->tokens) {
-        for (size_t i = 0; i < tokenizer->tokenLen; i++) {
-            LexerToken_free(tokenizer->tokens[i]);
+    if (tokenizer->data && tokenizer->mapped) munmap(tokenizer->data, tokenizer->size);
+    else if (tokenizer->data) free(tokenizer->data);
+    LexerTokens *tokens = &tokenizer->tokens;
+    free(tokens->type);
+    free(tokens->offset);
+    free(tokens->len);
+    free(tokens->line);
+    free(tokens->character);
+    free(tokens->position);
+    free(tokens->offsetBase);
+    free(tokens->lineBase);
+    free(tokens->positionBase);
+    free(tokens->wide);
+    free(tokenizer);
+}
+
+/**
+ * Token at index below tokenLen, rebuilt from the token stream.
+ */
+LexerToken Lexer_token(const Lexer *lexer, size_t index) {
+    const LexerTokens *tokens = &lexer->tokens;
+    if (tokens->offset[index] == LEXER_TOKEN_WIDE) {
+        size_t low = 0;
+        size_t high = tokens->wideLen;
+        while (high - low > 1) {
+            size_t mid = low + (high - low) / 2;
+            if (tokens->wide[mid].index <= index)
+                low = mid;
+            else
+                high = mid;
         }
+        return tokens->wide[low].token;
     }
-    free(tokenizer);
+    size_t block = index / LEXER_TOKEN_BLOCK;
+    LexerToken token;
+    token.type = (LexerType) tokens->type[index];
+    token.offset = tokens->offsetBase[block] + tokens->offset[index];
+    token.len = tokens->len[index];
+    token.position.line = tokens->lineBase[block] + tokens->line[index];
+    token.position.character = tokens->character[index];
+    token.position.position = tokens->positionBase[block] + tokens->position[index];
+    return token;
+}
+
+/**
+ * Token text is `len` bytes of UTF-8 input at `offset`, it isn't terminated.
+ */
+const char *LexerToken_text(const Lexer *lexer, const LexerToken *token) {
+    return lexer->data + token->offset;
+}
+
+short LexerToken_equals(const Lexer *lexer, const LexerToken *token, const char *str) {
+    return strlen(str) == token->len && memcmp(lexer->data + token->offset, str, token->len) == 0;
 }
 
-static void LexerToken_free(LexerToken *token) {
-    if (token->str) free(token->str);
-    free(token);
+/**
+ * Same as LexerToken_equals with ASCII case folded, keywords match this way.
+ */
+short LexerToken_iequals(const Lexer *lexer, const LexerToken *token, const char *str) {
+    return strlen(str) == token->len && strncasecmp(lexer->data + token->offset, str, token->len) == 0;
 }
 
+/**
+ * Token text as newly allocated wide string, caller frees it.
+ */
+wchar_t *LexerToken_wcs(const Lexer *lexer, const LexerToken *token) {
+    wchar_t *str = (wchar_t *) malloc(sizeof(wchar_t) * (token->len + 1));
+    const unsigned char *data = (const unsigned char *) lexer->data + token->offset;
+    size_t len = 0;
+    for (size_t pos = 0; pos < token->len; len++) {
+        if (data[pos] < 0x80) {
+            str[len] = (wchar_t) data[pos++];
+        } else {
+            size_t n = decode_utf8(data + pos, token->len - pos, &str[len]);
+            pos += n ? n : 1;
+        }
+    }
+    str[len] = 0;
+    return str;
+}
+
+/**
+ * Whole input is decoded as UTF-8 here, runs of ASCII found a vector at a
+ * time are passed on without decoding. Tokenizing stops at the first
+ * invalid sequence. Returns 0 when memory for tokens runs out.
+ */
 int Lexer_tokenize(Lexer *lexer) {
     if (lexer == NULL)
         return 0;
 
-    char *lang = getenv("LANG");
-    if (lang) {
-        setlocale(LC_ALL, lang);
-    } else {
-        setlocale(LC_ALL, "en_US.utf8");
+    while (lexer->pos < lexer->size && !lexer->failed) {
+        const char *at = lexer->data + lexer->pos;
+        size_t left = lexer->size - lexer->pos;
+        size_t run = lexer->asciiPrefix(at, left);
+        for (size_t end = lexer->pos + run; lexer->pos < end; lexer->pos++)
+            take_character(lexer, (wchar_t) lexer->data[lexer->pos], 1);
+        if (run == left)
+            break;
+
+        wchar_t c;
+        size_t len = decode_utf8((const unsigned char *) at + run, left - run, &c);
+        if (len == 0)
+            break;
+        take_character(lexer, c, len);
+        lexer->pos += len;
     }
+    return !lexer->failed;
+}
 
-    while (is_ok(lexer)) {
-        wchar_t c = fgetwc(lexer->in);
-        lexer->position.position += 1;
-        if (c < 0)
+static void take_character(Lexer *lexer, wchar_t c, size_t len) {
+    lexer->position.position += 1;
+    switch (c) {
+        case L' ': {
+            consume(lexer);
+            lexer->position.character += 1;
             break;
-        switch (c) {
-            case L' ': {
+        }
+        case L'.':
+        case L',':
+        case '=':
+        case '+':
+        case L'-':
+        case L'*':
+        case L'/':
+        case L'%':
+        case L'|':
+        case L'&':
+        case L';':
+        case L'<':
+        case L'>':
+        case L')':
+        case L'(':
+        case L'\'':
+        case L'\"': {
+            if (lexer->lexemeChars)
                 consume(lexer);
-                lexer->position.character += 1;
-                break;
-            }
-            case L'.':
-            case L',':
-            case L'=':
-            case L'+':
-            case L'-':
-            case L'*':
-            case L'/':
-            case L'%':
-            case L'|':
-            case L'&':
-            case L';':
-            case L'<':
-            case L'>':
-            case L')':
-            case L'(':
-            case L'\'':
-            case L'\"': {
-                if (lexer->buffer)
-                    consume(lexer);
-                store_character(lexer, c);
+            store_character(lexer, len);
+            consume(lexer);
+            break;
+        }
+        case L'\n': {
+            if (lexer->lexemeChars)
                 consume(lexer);
-                break;
-            }
-            case L'\n': {
-                if (lexer->buffer)
-                    consume(lexer);
-                lexer->position.character = 1;
-                lexer->position.line += 1;
-                break;
-            }
-            default: {
-                store_character(lexer, c);
-                break;
-            }
+            lexer->position.character = 1;
+            lexer->position.line += 1;
+            break;
+        }
+        default: {
+            store_character(lexer, len);
+            break;
         }
     }
-    return 1;
 }
 
-static void store_character(Lexer *tokenizer, wchar_t c) {
-    if (tokenizer->buffer == NULL) {
-        tokenizer->buffer = (wchar_t *) malloc(sizeof(wchar_t) * 2);
-        memset(tokenizer->buffer, 0, 2);
-        tokenizer->buffer[0] = c;
-        tokenizer->buffer[1] = 0;
+/**
+ * Decode one multibyte character, returns its length or 0 when it's invalid,
+ * overlong, surrogate or beyond U+10FFFF.
+ */
+static size_t decode_utf8(const unsigned char *data, size_t size, wchar_t *c) {
+    unsigned char lead = data[0];
+    size_t len;
+    uint32_t code, min;
+    if (lead >= 0xc2 && lead <= 0xdf) {
+        len = 2;
+        code = lead & 0x1f;
+        min = 0x80;
+    } else if (lead >= 0xe0 && lead <= 0xef) {
+        len = 3;
+        code = lead & 0x0f;
+        min = 0x800;
+    } else if (lead >= 0xf0 && lead <= 0xf4) {
+        len = 4;
+        code = lead & 0x07;
+        min = 0x10000;
     } else {
-        size_t len = wcslen(tokenizer->buffer) + 1;
-        tokenizer->buffer = (wchar_t *) realloc(tokenizer->buffer, sizeof(wchar_t) * (len + 1));
-        tokenizer->buffer[len - 1] = c;
-        tokenizer->buffer[len] = 0;
+        return 0;
     }
+    if (size < len)
+        return 0;
+    for (size_t i = 1; i < len; i++) {
+        if ((data[i] & 0xc0) != 0x80)
+            return 0;
+        code = (code << 6) | (data[i] & 0x3f);
+    }
+    if (code < min || code > 0x10ffff || (code >= 0xd800 && code <= 0xdfff))
+        return 0;
+    *c = (wchar_t) code;
+    return len;
+}
+
+/**
+ * Number of leading bytes of `data` below 0x80.
+ */
+static size_t ascii_prefix_scalar(const char *data, size_t size) {
+    size_t pos = 0;
+    for (; pos + sizeof(uint64_t) <= size; pos += sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, data + pos, sizeof(word));
+        if (word & 0x8080808080808080ULL)
+            break;
+    }
+    while (pos < size && (unsigned char) data[pos] < 0x80)
+        pos++;
+    return pos;
+}
+
+#ifdef LEXER_X86
+__attribute__((target("sse2")))
+static size_t ascii_prefix_sse2(const char *data, size_t size) {
+    size_t pos = 0;
+    for (; pos + 16 <= size; pos += 16) {
+        int mask = _mm_movemask_epi8(_mm_loadu_si128((const __m128i *) (data + pos)));
+        if (mask != 0)
+            return pos + (size_t) __builtin_ctz((unsigned) mask);
+    }
+    return pos + ascii_prefix_scalar(data + pos, size - pos);
+}
+
+__attribute__((target("avx2")))
+static size_t ascii_prefix_avx2(const char *data, size_t size) {
+    size_t pos = 0;
+    for (; pos + 32 <= size; pos += 32) {
+        int mask = _mm256_movemask_epi8(_mm256_loadu_si256((const __m256i *) (data + pos)));
+        if (mask != 0)
+            return pos + (size_t) __builtin_ctz((unsigned) mask);
+    }
+    return pos + ascii_prefix_scalar(data + pos, size - pos);
+}
+#endif
+
+/**
+ * Lexeme is the span of input from its first character, nothing is copied
+ * until the token is read.
+ */
+static void store_character(Lexer *tokenizer, size_t len) {
+    if (tokenizer->lexemeChars == 0)
+        tokenizer->lexemeStart = tokenizer->pos;
+    tokenizer->lexemeEnd = tokenizer->pos + len;
+    tokenizer->lexemeChars += 1;
     tokenizer->position.character += 1;
 }
 
 static void consume(Lexer *lexer) {
-    if (lexer->buffer == NULL)
+    if (lexer->lexemeChars == 0)
         return;
 
-    LexerToken *token = (LexerToken *) malloc(sizeof(LexerToken));
-    memset(token, 0, sizeof(LexerToken));
+    LexerToken token;
 
     if (is_keyword(lexer)) {
-        token->type = LexerType_Keyword;
+        token.type = LexerType_Keyword;
     } else if (is_number(lexer)) {
-        token->type = LexerType_Literal;
+        token.type = LexerType_Literal;
     } else if (is_operator(lexer)) {
-        token->type = LexerType_Operator;
+        token.type = LexerType_Operator;
     } else if (is_separator(lexer)) {
-        token->type = LexerType_Separator;
+        token.type = LexerType_Separator;
     } else {
-        token->type = LexerType_Identifier;
+        token.type = LexerType_Identifier;
     }
 
-    size_t bufLen = lexer->buffer ? wcslen(lexer->buffer) : 0;
-    token->str = lexer->buffer;
-    token->position.character = lexer->position.character - bufLen;
-    token->position.position = lexer->position.position - bufLen;
-    token->position.line = lexer->position.line;
+    size_t bufLen = lexer->lexemeChars;
+    token.offset = lexer->lexemeStart;
+    token.len = lexer->lexemeEnd - lexer->lexemeStart;
+    token.position.character = lexer->position.character - bufLen;
+    token.position.position = lexer->position.position - bufLen;
+    token.position.line = lexer->position.line;
+    push_token(lexer, &token);
 
-    if (lexer->tokens == NULL) {
-        lexer->tokens = (LexerToken **) malloc(sizeof(LexerToken *) * 1);
-        memset(lexer->tokens, 0, sizeof(LexerToken *));
-        lexer->tokens[0] = token;
-        lexer->tokenLen = 1;
-    } else {
-        size_t len = lexer->tokenLen + 1;
-        lexer->tokens = realloc(lexer->tokens, sizeof(LexerToken *) * len);
-        lexer->tokens[lexer->tokenLen] = token;
-        lexer->tokenLen += 1;
-    }
-    lexer->buffer = NULL;
+    lexer->lexemeChars = 0;
 }
 
-static int is_keyword(Lexer *tokenizer) {
-    if (tokenizer->buffer == NULL)
-        return 0;
-    for (size_t i = 0; i < Lexer_KEYWORDS_SIZE; i++) {
-        if (wcscmp(tokenizer->buffer, Lexer_KEYWORDS[i]) == 0)
-            return 1;
+/**
+ * Every array is grown to `cap` tokens, returns -1 when one can't be. Arrays
+ * grown before that stay valid and larger, `cap` is kept as it was.
+ */
+static int grow_tokens(LexerTokens *tokens, size_t cap) {
+    size_t blocks = cap / LEXER_TOKEN_BLOCK + 1;
+    unsigned char *type = (unsigned char *) realloc(tokens->type, sizeof(unsigned char) * cap);
+    if (type == NULL)
+        return -1;
+    tokens->type = type;
+
+    uint32_t **columns[] = {&tokens->offset, &tokens->len, &tokens->line, &tokens->character, &tokens->position};
+    for (size_t i = 0; i < sizeof(columns) / sizeof(columns[0]); i++) {
+        uint32_t *column = (uint32_t *) realloc(*columns[i], sizeof(uint32_t) * cap);
+        if (column == NULL)
+            return -1;
+        *columns[i] = column;
+    }
+    size_t **bases[] = {&tokens->offsetBase, &tokens->lineBase, &tokens->positionBase};
+    for (size_t i = 0; i < sizeof(bases) / sizeof(bases[0]); i++) {
+        size_t *base = (size_t *) realloc(*bases[i], sizeof(size_t) * blocks);
+        if (base == NULL)
+            return -1;
+        *bases[i] = base;
     }
+    tokens->cap = cap;
     return 0;
 }
 
+/**
+ * Token is appended relative to the first token of its block, one that
+ * doesn't fit is marked wide and kept whole, those are rare enough to be
+ * looked up by binary search. Lexer is marked failed when memory runs out.
+ */
+static void push_token(Lexer *lexer, const LexerToken *token) {
+    LexerTokens *tokens = &lexer->tokens;
+    size_t index = lexer->tokenLen;
+    if (lexer->failed)
+        return;
+    if (index == tokens->cap && grow_tokens(tokens, tokens->cap * 2) != 0) {
+        lexer->failed = 1;
+        return;
+    }
+
+    size_t block = index / LEXER_TOKEN_BLOCK;
+    if (index % LEXER_TOKEN_BLOCK == 0) {
+        tokens->offsetBase[block] = token->offset;
+        tokens->lineBase[block] = token->position.line;
+        tokens->positionBase[block] = token->position.position;
+    }
+    size_t offset = token->offset - tokens->offsetBase[block];
+    size_t line = token->position.line - tokens->lineBase[block];
+    size_t position = token->position.position - tokens->positionBase[block];
+
+    tokens->type[index] = (unsigned char) token->type;
+    if (token->offset < tokens->offsetBase[block] || offset >= LEXER_TOKEN_WIDE
+        || token->position.line < tokens->lineBase[block] || line > UINT32_MAX
+        || token->position.position < tokens->positionBase[block] || position > UINT32_MAX
+        || token->len > UINT32_MAX || token->position.character > UINT32_MAX) {
+        if (tokens->wideLen == tokens->wideCap) {
+            size_t cap = tokens->wideCap ? tokens->wideCap * 2 : 16;
+            LexerWideToken *wide = (LexerWideToken *) realloc(tokens->wide, sizeof(LexerWideToken) * cap);
+            if (wide == NULL) {
+                lexer->failed = 1;
+                return;
+            }
+            tokens->wide = wide;
+            tokens->wideCap = cap;
+        }
+        tokens->wide[tokens->wideLen].index = index;
+        tokens->wide[tokens->wideLen].token = *token;
+        tokens->wideLen += 1;
+        tokens->offset[index] = LEXER_TOKEN_WIDE;
+    } else {
+        tokens->offset[index] = (uint32_t) offset;
+        tokens->len[index] = (uint32_t) token->len;
+        tokens->line[index] = (uint32_t) line;
+        tokens->character[index] = (uint32_t) token->position.character;
+        tokens->position[index] = (uint32_t) position;
+    }
+    lexer->tokenLen += 1;
+}
+
 static int is_number(Lexer *tokenizer) {
-    wchar_t *b = tokenizer->buffer;
-    if (b == NULL) return 0;
-    size_t len = wcslen(b);
+    const char *b = tokenizer->data + tokenizer->lexemeStart;
+    size_t len = tokenizer->lexemeEnd - tokenizer->lexemeStart;
     short hadDot = 0;
     for (size_t i = 0; i < len; i++) {
-        wchar_t wc = b[i];
-        char c = (char) wc;
-        if (!isdigit(c) && wc != L'.') {
+        char c = b[i];
+        if (!isdigit((unsigned char) c) && c != '.') {
             return 0;
-        } else if (wc == L'.' && hadDot == 0) {
+        } else if (c == '.' && hadDot == 0) {
             hadDot = 1;
-        } else if (wc == L'.') {
+        } else if (c == '.') {
             return 0;
         }
     }
@@ -200,20 +447,16 @@ static int is_number(Lexer *tokenizer) {
 }
 
 static int is_operator(Lexer *tokenizer) {
-    wchar_t *b = tokenizer->buffer;
-    if (b == NULL) return 0;
-    size_t len = wcslen(b);
-    if (len > 1) return 0;
-    if (len < 1) return 0;
-    switch (*b) {
-        case L'=':
-        case L'+':
-        case L'-':
-        case L'*':
-        case L'/':
-        case L'%':
-        case L'|':
-        case L'&':
+    if (tokenizer->lexemeChars != 1) return 0;
+    switch (tokenizer->data[tokenizer->lexemeStart]) {
+        case '=':
+        case '+':
+        case '-':
+        case '*':
+        case '/':
+        case '%':
+        case '|':
+        case '&':
             return 1;
         default:
             return 0;
@@ -221,1558 +464,218 @@ static int is_operator(Lexer *tokenizer) {
 }
 
 static int is_separator(Lexer *tokenizer) {
-    wchar_t *b = tokenizer->buffer;
-    if (b == NULL) return 0;
-    size_t len = wcslen(b);
-    if (len > 1) return 0;
-    if (len < 1) return 0;
-    switch (*b) {
-        case L';':
-        case L'.':
-        case L',':
-        case L'<':
-        case L'>':
-        case L')':
-        case L'(':
+    if (tokenizer->lexemeChars != 1) return 0;
+    switch (tokenizer->data[tokenizer->lexemeStart]) {
+        case ';':
+        case '.':
+        case ',':
+        case '<':
+        case '>':
+        case ')':
+        case '(':
             return 1;
         default:
             return 0;
     }
 }
 
-static short is_ok(Lexer *tokenizer) {
-    if (feof(tokenizer->in))
-        return 0;
-    if (ferror(tokenizer->in))
-        return 0;
-    return 1;
-}
+/**
+ * Keywords ordered by length and then bytes, so a lookup only binary searches
+ * the words of its own length. Lexer_KEYWORD_BUCKETS[len] is the index of the
+ * first keyword of that length.
+ */
+static const char *const Lexer_KEYWORDS[] = {
+    /* 1 */
+    "A", "C", "G", "K", "M", "P", "T",
+    /* 2 */
+    "AS", "AT", "BY", "DB", "DO", "FS", "GO", "ID", "IF", "IN", "IS", "LN", "NO",
+    "OF", "ON", "OR", "TO",
+    /* 3 */
+    "ABS", "ADA", "ADD", "ALL", "AND", "ANY", "ARE", "ASC", "AVG", "BIT", "BOM",
+    "CSV", "DAY", "DEC", "END", "EXP", "FOR", "GET", "HEX", "INT", "KEY", "LAG",
+    "MAP", "MAX", "MIN", "MOD", "NEW", "NFC", "NFD", "NIL", "NOT", "OFF", "OLD",
+    "OUT", "PAD", "PLI", "REF", "ROW", "SET", "SQL", "SUM", "URI", "XML", "YES",
+    /* 4 */
+    "ALSO", "BLOB", "BOTH", "CALL", "CASE", "CAST", "CEIL", "CHAR", "CLOB", "COPY",
+    "CORR", "COST", "CUBE", "DATA", "DATE", "DESC", "DROP", "EACH", "ELSE", "ENUM",
+    "EXEC", "FILE", "FLAG", "FREE", "FROM", "FULL", "GOTO", "HOLD", "HOUR", "INTO",
+    "JOIN", "LAST", "LEAD", "LEFT", "LIKE", "LINK", "LOAD", "LOCK", "MODE", "MORE",
+    "MOVE", "NAME", "NEXT", "NFKC", "NFKD", "NONE", "NULL", "OIDS", "ONLY", "OPEN",
+    "OVER", "PATH", "RANK", "READ", "REAL", "ROLE", "ROWS", "RULE", "SELF", "SETS",
+    "SHOW", "SIZE", "SKIP", "SOME", "SQRT", "TEMP", "TEXT", "THEN", "TIES", "TIME",
+    "TRIM", "TRUE", "TYPE", "USER", "VIEW", "WHEN", "WITH", "WORK", "YEAR", "ZONE",
+    /* 5 */
+    "ABORT", "ADMIN", "AFTER", "ALTER", "ARRAY", "BEGIN", "CACHE", "CHAIN",
+    "CHECK", "CLASS", "CLOSE", "COBOL", "COUNT", "CROSS", "CYCLE", "DEPTH",
+    "DEREF", "EMPTY", "EVENT", "EVERY", "FALSE", "FETCH", "FINAL", "FIRST",
+    "FLOAT", "FLOOR", "FORCE", "FOUND", "GRANT", "GROUP", "ILIKE", "INDEX",
+    "INNER", "INOUT", "INPUT", "LABEL", "LARGE", "LEAST", "LEVEL", "LIMIT",
+    "LOCAL", "LOWER", "MATCH", "MERGE", "MONTH", "MUMPS", "NAMES", "NCHAR",
+    "NCLOB", "NTILE", "NULLS", "ORDER", "OUTER", "OWNED", "OWNER", "PLANS",
+    "POWER", "PRIOR", "QUOTE", "RANGE", "READS", "RESET", "RIGHT", "SCALE",
+    "SCOPE", "SETOF", "SHARE", "SPACE", "START", "STATE", "STDIN", "STRIP",
+    "STYLE", "SYSID", "TABLE", "TOKEN", "TREAT", "TYPES", "UNDER", "UNION",
+    "UNTIL", "UPPER", "USAGE", "USING", "VALID", "VALUE", "VIEWS", "WHERE",
+    "WRITE", "XMLPI",
+    /* 6 */
+    "ABSENT", "ACCESS", "ACTION", "ALWAYS", "ATOMIC", "ATTACH", "BASE64", "BEFORE",
+    "BIGINT", "BINARY", "CALLED", "COLUMN", "COMMIT", "CREATE", "CURSOR", "DEGREE",
+    "DELETE", "DETACH", "DOMAIN", "DOUBLE", "ENABLE", "EQUALS", "ESCAPE", "EXCEPT",
+    "EXISTS", "FAMILY", "FILTER", "FREEZE", "FUSION", "GLOBAL", "GROUPS", "HAVING",
+    "HEADER", "IGNORE", "IMPORT", "INDENT", "INLINE", "INSERT", "ISNULL", "LENGTH",
+    "LISTEN", "LOCKED", "LOGGED", "MEMBER", "METHOD", "MINUTE", "MODULE", "NOTIFY",
+    "NOWAIT", "NULLIF", "NUMBER", "OBJECT", "OCTETS", "OFFSET", "OPTION", "OTHERS",
+    "OUTPUT", "PARSER", "PASCAL", "PERIOD", "POLICY", "PUBLIC", "RENAME", "RESULT",
+    "RETURN", "REVOKE", "ROLLUP", "SCHEMA", "SCROLL", "SEARCH", "SECOND", "SELECT",
+    "SERVER", "SIMPLE", "SOURCE", "STABLE", "STATIC", "STDOUT", "STRICT", "SYSTEM",
+    "TABLES", "UNIQUE", "UNLINK", "UNNEST", "UPDATE", "VACUUM", "VALUES", "WINDOW",
+    "WITHIN", "XMLAGG",
+    /* 7 */
+    "ANALYSE", "ANALYZE", "BETWEEN", "BLOCKED", "BOOLEAN", "BREADTH", "CASCADE",
+    "CATALOG", "CEILING", "CLUSTER", "COLLATE", "COLLECT", "COLUMNS", "COMMENT",
+    "CONNECT", "CONTENT", "CONTROL", "CONVERT", "CURRENT", "DECIMAL", "DECLARE",
+    "DEFAULT", "DEFINED", "DEFINER", "DEPENDS", "DERIVED", "DISABLE", "DISCARD",
+    "DLVALUE", "DYNAMIC", "ELEMENT", "EXCLUDE", "EXECUTE", "EXPLAIN", "EXTRACT",
+    "FOREIGN", "FORTRAN", "FORWARD", "GENERAL", "GRANTED", "HANDLER", "INCLUDE",
+    "INDEXES", "INHERIT", "INSTEAD", "INTEGER", "INVOKER", "LATERAL", "LEADING",
+    "LIBRARY", "LOCATOR", "MAPPING", "MATCHED", "NATURAL", "NESTING", "NOTHING",
+    "NOTNULL", "NUMERIC", "OPTIONS", "OVERLAY", "PARTIAL", "PASSING", "PERCENT",
+    "PLACING", "PORTION", "PREPARE", "PRIMARY", "PROGRAM", "RECHECK", "REFRESH",
+    "REGR_R2", "REINDEX", "RELEASE", "REPLACE", "REPLICA", "RESPECT", "RESTART",
+    "RESTORE", "RETURNS", "ROUTINE", "SCHEMAS", "SECTION", "SESSION", "SIMILAR",
+    "SQLCODE", "STORAGE", "TRIGGER", "TRUSTED", "UESCAPE", "UNKNOWN", "UNNAMED",
+    "UNTYPED", "VARCHAR", "VARYING", "VAR_POP", "VERBOSE", "VERSION", "WITHOUT",
+    "WRAPPER", "XMLCAST", "XMLROOT", "XMLTEXT",
+    /* 8 */
+    "ABSOLUTE", "ALLOCATE", "BACKWARD", "CASCADED", "COALESCE", "COMMENTS",
+    "CONFLICT", "CONTAINS", "CONTINUE", "DATABASE", "DATALINK", "DEFAULTS",
+    "DEFERRED", "DESCRIBE", "DISPATCH", "DISTINCT", "DOCUMENT", "ENCODING",
+    "END-EXEC", "ENFORCED", "EXTERNAL", "FUNCTION", "GREATEST", "GROUPING",
+    "IDENTITY", "IMPLICIT", "INHERITS", "INSTANCE", "INTERVAL", "KEY_TYPE",
+    "LANGUAGE", "LOCATION", "MAXVALUE", "MINVALUE", "MODIFIES", "MULTISET",
+    "NATIONAL", "NULLABLE", "OPERATOR", "ORDERING", "OVERLAPS", "PARALLEL",
+    "PASSWORD", "POSITION", "PRECEDES", "PREPARED", "PRESERVE", "REASSIGN",
+    "RECOVERY", "REGR_SXX", "REGR_SXY", "REGR_SYY", "RELATIVE", "RESTRICT",
+    "ROLLBACK", "ROUTINES", "SECURITY", "SEQUENCE", "SMALLINT", "SNAPSHOT",
+    "SPECIFIC", "SQLERROR", "SQLSTATE", "SUCCEEDS", "TEMPLATE", "TRAILING",
+    "TRUNCATE", "UNLISTEN", "UNLOGGED", "VALIDATE", "VALUE_OF", "VARIADIC",
+    "VAR_SAMP", "VOLATILE", "WHENEVER", "XMLPARSE", "XMLQUERY", "XMLTABLE",
+    /* 9 */
+    "ACCORDING", "AGGREGATE", "ARRAY_AGG", "ASSERTION", "ATTRIBUTE", "BERNOULLI",
+    "CHARACTER", "COLLATION", "COMMITTED", "CONDITION", "COVAR_POP", "CUME_DIST",
+    "DELIMITER", "DLNEWCOPY", "DLURLPATH", "ENCRYPTED", "END_FRAME", "EXCEPTION",
+    "EXCLUDING", "EXCLUSIVE", "EXTENSION", "FOLLOWING", "FRAME_ROW", "FUNCTIONS",
+    "GENERATED", "HIERARCHY", "IMMEDIATE", "IMMUTABLE", "INCLUDING", "INCREMENT",
+    "INDICATOR", "INITIALLY", "INTEGRITY", "INTERSECT", "ISOLATION", "LEAKPROOF",
+    "LOCALTIME", "NAMESPACE", "NORMALIZE", "NTH_VALUE", "PARAMETER", "PARTITION",
+    "PRECEDING", "PRECISION", "PROCEDURE", "RECURSIVE", "REGR_AVGX", "REGR_AVGY",
+    "REQUIRING", "RETURNING", "ROW_COUNT", "SAVEPOINT", "SELECTIVE", "SENSITIVE",
+    "SEQUENCES", "STATEMENT", "STRUCTURE", "SUBSTRING", "SYMMETRIC", "TEMPORARY",
+    "TIMESTAMP", "TRANSFORM", "TRANSLATE", "UNBOUNDED", "VALIDATOR", "VARBINARY",
+    "XMLBINARY", "XMLCONCAT", "XMLEXISTS", "XMLFOREST", "XMLSCHEMA",
+    /* 10 */
+    "ASENSITIVE", "ASSIGNMENT", "ASYMMETRIC", "ATTRIBUTES", "BIT_LENGTH",
+    "CHARACTERS", "CHECKPOINT", "CONNECTION", "CONSTRAINT", "CONVERSION",
+    "COVAR_SAMP", "DEALLOCATE", "DEFERRABLE", "DELIMITERS", "DENSE_RANK",
+    "DESCRIPTOR", "DICTIONARY", "DISCONNECT", "EXPRESSION", "KEY_MEMBER",
+    "LAST_VALUE", "LIKE_REGEX", "NORMALIZED", "ORDINALITY", "OVERRIDING",
+    "PERMISSION", "PRIVILEGES", "PROCEDURAL", "PROCEDURES", "REFERENCES",
+    "REGR_COUNT", "REGR_SLOPE", "REPEATABLE", "ROW_NUMBER", "SCOPE_NAME",
+    "SQLWARNING", "STANDALONE", "STATISTICS", "STDDEV_POP", "TABLESPACE",
+    "TABLE_NAME", "TRANSFORMS", "TRIM_ARRAY", "VERSIONING", "WHITESPACE",
+    "XMLCOMMENT", "XMLELEMENT", "XMLITERATE",
+    /* 11 */
+    "BEGIN_FRAME", "CARDINALITY", "CHAR_LENGTH", "COLUMN_NAME", "CONSTRAINTS",
+    "CONSTRUCTOR", "CURRENT_ROW", "CURSOR_NAME", "DIAGNOSTICS", "DLURLSCHEME",
+    "DLURLSERVER", "FIRST_VALUE", "IMMEDIATELY", "INSENSITIVE", "PASSTHROUGH",
+    "PUBLICATION", "REFERENCING", "SCHEMA_NAME", "SERVER_NAME", "STDDEV_SAMP",
+    "SUBMULTISET", "SYSTEM_TIME", "SYSTEM_USER", "TABLESAMPLE", "TRANSACTION",
+    "TRANSLATION", "UNCOMMITTED", "UNENCRYPTED", "XMLDOCUMENT", "XMLVALIDATE",
+    /* 12 */
+    "CATALOG_NAME", "CLASS_ORIGIN", "CONCURRENTLY", "CURRENT_DATE", "CURRENT_PATH",
+    "CURRENT_ROLE", "CURRENT_TIME", "CURRENT_USER", "INSTANTIABLE", "INTERSECTION",
+    "MATERIALIZED", "MESSAGE_TEXT", "OCTET_LENGTH", "PERCENT_RANK", "ROUTINE_NAME",
+    "SCOPE_SCHEMA", "SERIALIZABLE", "SESSION_USER", "SPECIFICTYPE", "SQLEXCEPTION",
+    "SUBSCRIPTION", "TRIGGER_NAME", "WIDTH_BUCKET", "XMLSERIALIZE",
+    /* 13 */
+    "AUTHORIZATION", "CONFIGURATION", "CORRESPONDING", "DETERMINISTIC",
+    "DLURLCOMPLETE", "DLURLPATHONLY", "END_PARTITION", "SCOPE_CATALOG",
+    "SPECIFIC_NAME", "TIMEZONE_HOUR", "XMLATTRIBUTES", "XMLNAMESPACES",
+    /* 14 */
+    "COLLATION_NAME", "CURRENT_SCHEMA", "DLPREVIOUSCOPY", "DLURLPATHWRITE",
+    "IMPLEMENTATION", "LOCALTIMESTAMP", "MESSAGE_LENGTH", "PARAMETER_MODE",
+    "PARAMETER_NAME", "POSITION_REGEX", "REGR_INTERCEPT", "ROUTINE_SCHEMA",
+    "TRIGGER_SCHEMA", "XMLDECLARATION",
+    /* 15 */
+    "BEGIN_PARTITION", "CHARACTERISTICS", "CONNECTION_NAME", "CONSTRAINT_NAME",
+    "CURRENT_CATALOG", "MAX_CARDINALITY", "PERCENTILE_CONT", "PERCENTILE_DISC",
+    "RETURNED_LENGTH", "ROUTINE_CATALOG", "SUBCLASS_ORIGIN", "SUBSTRING_REGEX",
+    "TIMEZONE_MINUTE", "TOP_LEVEL_COUNT", "TRANSLATE_REGEX", "TRIGGER_CATALOG",
+    /* 16 */
+    "CHARACTER_LENGTH", "COLLATION_SCHEMA", "COMMAND_FUNCTION", "CONDITION_NUMBER",
+    "DYNAMIC_FUNCTION",
+    /* 17 */
+    "COLLATION_CATALOG", "CONSTRAINT_SCHEMA", "CURRENT_TIMESTAMP",
+    "DLURLCOMPLETEONLY", "OCCURRENCES_REGEX", "RETURNED_SQLSTATE",
+    /* 18 */
+    "CHARACTER_SET_NAME", "CONSTRAINT_CATALOG", "DLURLCOMPLETEWRITE",
+    "TRANSACTION_ACTIVE",
+    /* 20 */
+    "CHARACTER_SET_SCHEMA", "MESSAGE_OCTET_LENGTH", "RETURNED_CARDINALITY",
+    /* 21 */
+    "ARRAY_MAX_CARDINALITY", "CHARACTER_SET_CATALOG", "COMMAND_FUNCTION_CODE",
+    "DYNAMIC_FUNCTION_CODE", "RETURNED_OCTET_LENGTH",
+    /* 22 */
+    "DATETIME_INTERVAL_CODE", "TRANSACTIONS_COMMITTED", "USER_DEFINED_TYPE_CODE",
+    "USER_DEFINED_TYPE_NAME",
+    /* 23 */
+    "PARAMETER_SPECIFIC_NAME",
+    /* 24 */
+    "TRANSACTIONS_ROLLED_BACK", "USER_DEFINED_TYPE_SCHEMA",
+    /* 25 */
+    "PARAMETER_SPECIFIC_SCHEMA", "USER_DEFINED_TYPE_CATALOG",
+    /* 26 */
+    "PARAMETER_ORDINAL_POSITION", "PARAMETER_SPECIFIC_CATALOG",
+    /* 27 */
+    "DATETIME_INTERVAL_PRECISION",
+    /* 31 */
+    "CURRENT_DEFAULT_TRANSFORM_GROUP",
+    /* 32 */
+    "CURRENT_TRANSFORM_GROUP_FOR_TYPE",
+};
 
-static const wchar_t *Lexer_A = L"A";
-static const wchar_t *Lexer_ABORT = L"ABORT";
-static const wchar_t *Lexer_ABS = L"ABS";
-static const wchar_t *Lexer_ABSENT = L"ABSENT";
-static const wchar_t *Lexer_ABSOLUTE = L"ABSOLUTE";
-static const wchar_t *Lexer_ACCESS = L"ACCESS";
-static const wchar_t *Lexer_ACCORDING = L"ACCORDING";
-static const wchar_t *Lexer_ACTION = L"ACTION";
-static const wchar_t *Lexer_ADA = L"ADA";
-static const wchar_t *Lexer_ADD = L"ADD";
-static const wchar_t *Lexer_ADMIN = L"ADMIN";
-static const wchar_t *Lexer_AFTER = L"AFTER";
-static const wchar_t *Lexer_AGGREGATE = L"AGGREGATE";
-static const wchar_t *Lexer_ALL = L"ALL";
-static const wchar_t *Lexer_ALLOCATE = L"ALLOCATE";
-static const wchar_t *Lexer_ALSO = L"ALSO";
-static const wchar_t *Lexer_ALTER = L"ALTER";
-static const wchar_t *Lexer_ALWAYS = L"ALWAYS";
-static const wchar_t *Lexer_ANALYSE = L"ANALYSE";
-static const wchar_t *Lexer_ANALYZE = L"ANALYZE";
-static const wchar_t *Lexer_AND = L"AND";
-static const wchar_t *Lexer_ANY = L"ANY";
-static const wchar_t *Lexer_ARE = L"ARE";
-static const wchar_t *Lexer_ARRAY = L"ARRAY";
-static const wchar_t *Lexer_ARRAY_AGG = L"ARRAY_AGG";
-static const wchar_t *Lexer_ARRAY_MAX_CARDINALITY = L"ARRAY_MAX_CARDINALITY";
-static const wchar_t *Lexer_AS = L"AS";
-static const wchar_t *Lexer_ASC = L"ASC";
-static const wchar_t *Lexer_ASENSITIVE = L"ASENSITIVE";
-static const wchar_t *Lexer_ASSERTION = L"ASSERTION";
-static const wchar_t *Lexer_ASSIGNMENT = L"ASSIGNMENT";
-static const wchar_t *Lexer_ASYMMETRIC = L"ASYMMETRIC";
-static const wchar_t *Lexer_AT = L"AT";
-static const wchar_t *Lexer_ATOMIC = L"ATOMIC";
-static const wchar_t *Lexer_ATTACH = L"ATTACH";
-static const wchar_t *Lexer_ATTRIBUTE = L"ATTRIBUTE";
-static const wchar_t *Lexer_ATTRIBUTES = L"ATTRIBUTES";
-static const wchar_t *Lexer_AUTHORIZATION = L"AUTHORIZATION";
-static const wchar_t *Lexer_AVG = L"AVG";
-static const wchar_t *Lexer_BACKWARD = L"BACKWARD";
-static const wchar_t *Lexer_BASE64 = L"BASE64";
-static const wchar_t *Lexer_BEFORE = L"BEFORE";
-static const wchar_t *Lexer_BEGIN = L"BEGIN";
-static const wchar_t *Lexer_BEGIN_FRAME = L"BEGIN_FRAME";
-static const wchar_t *Lexer_BEGIN_PARTITION = L"BEGIN_PARTITION";
-static const wchar_t *Lexer_BERNOULLI = L"BERNOULLI";
-static const wchar_t *Lexer_BETWEEN = L"BETWEEN";
-static const wchar_t *Lexer_BIGINT = L"BIGINT";
-static const wchar_t *Lexer_BINARY = L"BINARY";
-static const wchar_t *Lexer_BIT = L"BIT";
-static const wchar_t *Lexer_BIT_LENGTH = L"BIT_LENGTH";
-static const wchar_t *Lexer_BLOB = L"BLOB";
-static const wchar_t *Lexer_BLOCKED = L"BLOCKED";
-static const wchar_t *Lexer_BOM = L"BOM";
-static const wchar_t *Lexer_BOOLEAN = L"BOOLEAN";
-static const wchar_t *Lexer_BOTH = L"BOTH";
-static const wchar_t *Lexer_BREADTH = L"BREADTH";
-static const wchar_t *Lexer_BY = L"BY";
-static const wchar_t *Lexer_C = L"C";
-static const wchar_t *Lexer_CACHE = L"CACHE";
-static const wchar_t *Lexer_CALL = L"CALL";
-static const wchar_t *Lexer_CALLED = L"CALLED";
-static const wchar_t *Lexer_CARDINALITY = L"CARDINALITY";
-static const wchar_t *Lexer_CASCADE = L"CASCADE";
-static const wchar_t *Lexer_CASCADED = L"CASCADED";
-static const wchar_t *Lexer_CASE = L"CASE";
-static const wchar_t *Lexer_CAST = L"CAST";
-static const wchar_t *Lexer_CATALOG = L"CATALOG";
-static const wchar_t *Lexer_CATALOG_NAME = L"CATALOG_NAME";
-static const wchar_t *Lexer_CEIL = L"CEIL";
-static const wchar_t *Lexer_CEILING = L"CEILING";
-static const wchar_t *Lexer_CHAIN = L"CHAIN";
-static const wchar_t *Lexer_CHAR = L"CHAR";
-static const wchar_t *Lexer_CHARACTER = L"CHARACTER";
-static const wchar_t *Lexer_CHARACTERISTICS = L"CHARACTERISTICS";
-static const wchar_t *Lexer_CHARACTERS = L"CHARACTERS";
-static const wchar_t *Lexer_CHARACTER_LENGTH = L"CHARACTER_LENGTH";
-static const wchar_t *Lexer_CHARACTER_SET_CATALOG = L"CHARACTER_SET_CATALOG";
-static const wchar_t *Lexer_CHARACTER_SET_NAME = L"CHARACTER_SET_NAME";
-static const wchar_t *Lexer_CHARACTER_SET_SCHEMA = L"CHARACTER_SET_SCHEMA";
-static const wchar_t *Lexer_CHAR_LENGTH = L"CHAR_LENGTH";
-static const wchar_t *Lexer_CHECK = L"CHECK";
-static const wchar_t *Lexer_CHECKPOINT = L"CHECKPOINT";
-static const wchar_t *Lexer_CLASS = L"CLASS";
-static const wchar_t *Lexer_CLASS_ORIGIN = L"CLASS_ORIGIN";
-static const wchar_t *Lexer_CLOB = L"CLOB";
-static const wchar_t *Lexer_CLOSE = L"CLOSE";
-static const wchar_t *Lexer_CLUSTER = L"CLUSTER";
-static const wchar_t *Lexer_COALESCE = L"COALESCE";
-static const wchar_t *Lexer_COBOL = L"COBOL";
-static const wchar_t *Lexer_COLLATE = L"COLLATE";
-static const wchar_t *Lexer_COLLATION = L"COLLATION";
-static const wchar_t *Lexer_COLLATION_CATALOG = L"COLLATION_CATALOG";
-static const wchar_t *Lexer_COLLATION_NAME = L"COLLATION_NAME";
-static const wchar_t *Lexer_COLLATION_SCHEMA = L"COLLATION_SCHEMA";
-static const wchar_t *Lexer_COLLECT = L"COLLECT";
-static const wchar_t *Lexer_COLUMN = L"COLUMN";
-static const wchar_t *Lexer_COLUMNS = L"COLUMNS";
-static const wchar_t *Lexer_COLUMN_NAME = L"COLUMN_NAME";
-static const wchar_t *Lexer_COMMAND_FUNCTION = L"COMMAND_FUNCTION";
-static const wchar_t *Lexer_COMMAND_FUNCTION_CODE = L"COMMAND_FUNCTION_CODE";
-static const wchar_t *Lexer_COMMENT = L"COMMENT";
-static const wchar_t *Lexer_COMMENTS = L"COMMENTS";
-static const wchar_t *Lexer_COMMIT = L"COMMIT";
-static const wchar_t *Lexer_COMMITTED = L"COMMITTED";
-static const wchar_t *Lexer_CONCURRENTLY = L"CONCURRENTLY";
-static const wchar_t *Lexer_CONDITION = L"CONDITION";
-static const wchar_t *Lexer_CONDITION_NUMBER = L"CONDITION_NUMBER";
-static const wchar_t *Lexer_CONFIGURATION = L"CONFIGURATION";
-static const wchar_t *Lexer_CONFLICT = L"CONFLICT";
-static const wchar_t *Lexer_CONNECT = L"CONNECT";
-static const wchar_t *Lexer_CONNECTION = L"CONNECTION";
-static const wchar_t *Lexer_CONNECTION_NAME = L"CONNECTION_NAME";
-static const wchar_t *Lexer_CONSTRAINT = L"CONSTRAINT";
-static const wchar_t *Lexer_CONSTRAINTS = L"CONSTRAINTS";
-static const wchar_t *Lexer_CONSTRAINT_CATALOG = L"CONSTRAINT_CATALOG";
-static const wchar_t *Lexer_CONSTRAINT_NAME = L"CONSTRAINT_NAME";
-static const wchar_t *Lexer_CONSTRAINT_SCHEMA = L"CONSTRAINT_SCHEMA";
-static const wchar_t *Lexer_CONSTRUCTOR = L"CONSTRUCTOR";
-static const wchar_t *Lexer_CONTAINS = L"CONTAINS";
-static const wchar_t *Lexer_CONTENT = L"CONTENT";
-static const wchar_t *Lexer_CONTINUE = L"CONTINUE";
-static const wchar_t *Lexer_CONTROL = L"CONTROL";
-static const wchar_t *Lexer_CONVERSION = L"CONVERSION";
-static const wchar_t *Lexer_CONVERT = L"CONVERT";
-static const wchar_t *Lexer_COPY = L"COPY";
-static const wchar_t *Lexer_CORR = L"CORR";
-static const wchar_t *Lexer_CORRESPONDING = L"CORRESPONDING";
-static const wchar_t *Lexer_COST = L"COST";
-static const wchar_t *Lexer_COUNT = L"COUNT";
-static const wchar_t *Lexer_COVAR_POP = L"COVAR_POP";
-static const wchar_t *Lexer_COVAR_SAMP = L"COVAR_SAMP";
-static const wchar_t *Lexer_CREATE = L"CREATE";
-static const wchar_t *Lexer_CROSS = L"CROSS";
-static const wchar_t *Lexer_CSV = L"CSV";
-static const wchar_t *Lexer_CUBE = L"CUBE";
-static const wchar_t *Lexer_CUME_DIST = L"CUME_DIST";
-static const wchar_t *Lexer_CURRENT = L"CURRENT";
-static const wchar_t *Lexer_CURRENT_CATALOG = L"CURRENT_CATALOG";
-static const wchar_t *Lexer_CURRENT_DATE = L"CURRENT_DATE";
-static const wchar_t *Lexer_CURRENT_DEFAULT_TRANSFORM_GROUP = L"CURRENT_DEFAULT_TRANSFORM_GROUP";
-static const wchar_t *Lexer_CURRENT_PATH = L"CURRENT_PATH";
-static const wchar_t *Lexer_CURRENT_ROLE = L"CURRENT_ROLE";
-static const wchar_t *Lexer_CURRENT_ROW = L"CURRENT_ROW";
-static const wchar_t *Lexer_CURRENT_SCHEMA = L"CURRENT_SCHEMA";
-static const wchar_t *Lexer_CURRENT_TIME = L"CURRENT_TIME";
-static const wchar_t *Lexer_CURRENT_TIMESTAMP = L"CURRENT_TIMESTAMP";
-static const wchar_t *Lexer_CURRENT_TRANSFORM_GROUP_FOR_TYPE = L"CURRENT_TRANSFORM_GROUP_FOR_TYPE";
-static const wchar_t *Lexer_CURRENT_USER = L"CURRENT_USER";
-static const wchar_t *Lexer_CURSOR = L"CURSOR";
-static const wchar_t *Lexer_CURSOR_NAME = L"CURSOR_NAME";
-static const wchar_t *Lexer_CYCLE = L"CYCLE";
-static const wchar_t *Lexer_DATA = L"DATA";
-static const wchar_t *Lexer_DATABASE = L"DATABASE";
-static const wchar_t *Lexer_DATALINK = L"DATALINK";
-static const wchar_t *Lexer_DATE = L"DATE";
-static const wchar_t *Lexer_DATETIME_INTERVAL_CODE = L"DATETIME_INTERVAL_CODE";
-static const wchar_t *Lexer_DATETIME_INTERVAL_PRECISION = L"DATETIME_INTERVAL_PRECISION";
-static const wchar_t *Lexer_DAY = L"DAY";
-static const wchar_t *Lexer_DB = L"DB";
-static const wchar_t *Lexer_DEALLOCATE = L"DEALLOCATE";
-static const wchar_t *Lexer_DEC = L"DEC";
-static const wchar_t *Lexer_DECIMAL = L"DECIMAL";
-static const wchar_t *Lexer_DECLARE = L"DECLARE";
-static const wchar_t *Lexer_DEFAULT = L"DEFAULT";
-static const wchar_t *Lexer_DEFAULTS = L"DEFAULTS";
-static const wchar_t *Lexer_DEFERRABLE = L"DEFERRABLE";
-static const wchar_t *Lexer_DEFERRED = L"DEFERRED";
-static const wchar_t *Lexer_DEFINED = L"DEFINED";
-static const wchar_t *Lexer_DEFINER = L"DEFINER";
-static const wchar_t *Lexer_DEGREE = L"DEGREE";
-static const wchar_t *Lexer_DELETE = L"DELETE";
-static const wchar_t *Lexer_DELIMITER = L"DELIMITER";
-static const wchar_t *Lexer_DELIMITERS = L"DELIMITERS";
-static const wchar_t *Lexer_DENSE_RANK = L"DENSE_RANK";
-static const wchar_t *Lexer_DEPENDS = L"DEPENDS";
-static const wchar_t *Lexer_DEPTH = L"DEPTH";
-static const wchar_t *Lexer_DEREF = L"DEREF";
-static const wchar_t *Lexer_DERIVED = L"DERIVED";
-static const wchar_t *Lexer_DESC = L"DESC";
-static const wchar_t *Lexer_DESCRIBE = L"DESCRIBE";
-static const wchar_t *Lexer_DESCRIPTOR = L"DESCRIPTOR";
-static const wchar_t *Lexer_DETACH = L"DETACH";
-static const wchar_t *Lexer_DETERMINISTIC = L"DETERMINISTIC";
-static const wchar_t *Lexer_DIAGNOSTICS = L"DIAGNOSTICS";
-static const wchar_t *Lexer_DICTIONARY = L"DICTIONARY";
-static const wchar_t *Lexer_DISABLE = L"DISABLE";
-static const wchar_t *Lexer_DISCARD = L"DISCARD";
-static const wchar_t *Lexer_DISCONNECT = L"DISCONNECT";
-static const wchar_t *Lexer_DISPATCH = L"DISPATCH";
-static const wchar_t *Lexer_DISTINCT = L"DISTINCT";
-static const wchar_t *Lexer_DLNEWCOPY = L"DLNEWCOPY";
-static const wchar_t *Lexer_DLPREVIOUSCOPY = L"DLPREVIOUSCOPY";
-static const wchar_t *Lexer_DLURLCOMPLETE = L"DLURLCOMPLETE";
-static const wchar_t *Lexer_DLURLCOMPLETEONLY = L"DLURLCOMPLETEONLY";
-static const wchar_t *Lexer_DLURLCOMPLETEWRITE = L"DLURLCOMPLETEWRITE";
-static const wchar_t *Lexer_DLURLPATH = L"DLURLPATH";
-static const wchar_t *Lexer_DLURLPATHONLY = L"DLURLPATHONLY";
-static const wchar_t *Lexer_DLURLPATHWRITE = L"DLURLPATHWRITE";
-static const wchar_t *Lexer_DLURLSCHEME = L"DLURLSCHEME";
-static const wchar_t *Lexer_DLURLSERVER = L"DLURLSERVER";
-static const wchar_t *Lexer_DLVALUE = L"DLVALUE";
-static const wchar_t *Lexer_DO = L"DO";
-static const wchar_t *Lexer_DOCUMENT = L"DOCUMENT";
-static const wchar_t *Lexer_DOMAIN = L"DOMAIN";
-static const wchar_t *Lexer_DOUBLE = L"DOUBLE";
-static const wchar_t *Lexer_DROP = L"DROP";
-static const wchar_t *Lexer_DYNAMIC = L"DYNAMIC";
-static const wchar_t *Lexer_DYNAMIC_FUNCTION = L"DYNAMIC_FUNCTION";
-static const wchar_t *Lexer_DYNAMIC_FUNCTION_CODE = L"DYNAMIC_FUNCTION_CODE";
-static const wchar_t *Lexer_EACH = L"EACH";
-static const wchar_t *Lexer_ELEMENT = L"ELEMENT";
-static const wchar_t *Lexer_ELSE = L"ELSE";
-static const wchar_t *Lexer_EMPTY = L"EMPTY";
-static const wchar_t *Lexer_ENABLE = L"ENABLE";
-static const wchar_t *Lexer_ENCODING = L"ENCODING";
-static const wchar_t *Lexer_ENCRYPTED = L"ENCRYPTED";
-static const wchar_t *Lexer_END = L"END";
-static const wchar_t *Lexer_END_EXEC = L"END-EXEC";
-static const wchar_t *Lexer_END_FRAME = L"END_FRAME";
-static const wchar_t *Lexer_END_PARTITION = L"END_PARTITION";
-static const wchar_t *Lexer_ENFORCED = L"ENFORCED";
-static const wchar_t *Lexer_ENUM = L"ENUM";
-static const wchar_t *Lexer_EQUALS = L"EQUALS";
-static const wchar_t *Lexer_ESCAPE = L"ESCAPE";
-static const wchar_t *Lexer_EVENT = L"EVENT";
-static const wchar_t *Lexer_EVERY = L"EVERY";
-static const wchar_t *Lexer_EXCEPT = L"EXCEPT";
-static const wchar_t *Lexer_EXCEPTION = L"EXCEPTION";
-static const wchar_t *Lexer_EXCLUDE = L"EXCLUDE";
-static const wchar_t *Lexer_EXCLUDING = L"EXCLUDING";
-static const wchar_t *Lexer_EXCLUSIVE = L"EXCLUSIVE";
-static const wchar_t *Lexer_EXEC = L"EXEC";
-static const wchar_t *Lexer_EXECUTE = L"EXECUTE";
-static const wchar_t *Lexer_EXISTS = L"EXISTS";
-static const wchar_t *Lexer_EXP = L"EXP";
-static const wchar_t *Lexer_EXPLAIN = L"EXPLAIN";
-static const wchar_t *Lexer_EXPRESSION = L"EXPRESSION";
-static const wchar_t *Lexer_EXTENSION = L"EXTENSION";
-static const wchar_t *Lexer_EXTERNAL = L"EXTERNAL";
-static const wchar_t *Lexer_EXTRACT = L"EXTRACT";
-static const wchar_t *Lexer_FALSE = L"FALSE";
-static const wchar_t *Lexer_FAMILY = L"FAMILY";
-static const wchar_t *Lexer_FETCH = L"FETCH";
-static const wchar_t *Lexer_FILE = L"FILE";
-static const wchar_t *Lexer_FILTER = L"FILTER";
-static const wchar_t *Lexer_FINAL = L"FINAL";
-static const wchar_t *Lexer_FIRST = L"FIRST";
-static const wchar_t *Lexer_FIRST_VALUE = L"FIRST_VALUE";
-static const wchar_t *Lexer_FLAG = L"FLAG";
-static const wchar_t *Lexer_FLOAT = L"FLOAT";
-static const wchar_t *Lexer_FLOOR = L"FLOOR";
-static const wchar_t *Lexer_FOLLOWING = L"FOLLOWING";
-static const wchar_t *Lexer_FOR = L"FOR";
-static const wchar_t *Lexer_FORCE = L"FORCE";
-static const wchar_t *Lexer_FOREIGN = L"FOREIGN";
-static const wchar_t *Lexer_FORTRAN = L"FORTRAN";
-static const wchar_t *Lexer_FORWARD = L"FORWARD";
-static const wchar_t *Lexer_FOUND = L"FOUND";
-static const wchar_t *Lexer_FRAME_ROW = L"FRAME_ROW";
-static const wchar_t *Lexer_FREE = L"FREE";
-static const wchar_t *Lexer_FREEZE = L"FREEZE";
-static const wchar_t *Lexer_FROM = L"FROM";
-static const wchar_t *Lexer_FS = L"FS";
-static const wchar_t *Lexer_FULL = L"FULL";
-static const wchar_t *Lexer_FUNCTION = L"FUNCTION";
-static const wchar_t *Lexer_FUNCTIONS = L"FUNCTIONS";
-static const wchar_t *Lexer_FUSION = L"FUSION";
-static const wchar_t *Lexer_G = L"G";
-static const wchar_t *Lexer_GENERAL = L"GENERAL";
-static const wchar_t *Lexer_GENERATED = L"GENERATED";
-static const wchar_t *Lexer_GET = L"GET";
-static const wchar_t *Lexer_GLOBAL = L"GLOBAL";
-static const wchar_t *Lexer_GO = L"GO";
-static const wchar_t *Lexer_GOTO = L"GOTO";
-static const wchar_t *Lexer_GRANT = L"GRANT";
-static const wchar_t *Lexer_GRANTED = L"GRANTED";
-static const wchar_t *Lexer_GREATEST = L"GREATEST";
-static const wchar_t *Lexer_GROUP = L"GROUP";
-static const wchar_t *Lexer_GROUPING = L"GROUPING";
-static const wchar_t *Lexer_GROUPS = L"GROUPS";
-static const wchar_t *Lexer_HANDLER = L"HANDLER";
-static const wchar_t *Lexer_HAVING = L"HAVING";
-static const wchar_t *Lexer_HEADER = L"HEADER";
-static const wchar_t *Lexer_HEX = L"HEX";
-static const wchar_t *Lexer_HIERARCHY = L"HIERARCHY";
-static const wchar_t *Lexer_HOLD = L"HOLD";
-static const wchar_t *Lexer_HOUR = L"HOUR";
-static const wchar_t *Lexer_ID = L"ID";
-static const wchar_t *Lexer_IDENTITY = L"IDENTITY";
-static const wchar_t *Lexer_IF = L"IF";
-static const wchar_t *Lexer_IGNORE = L"IGNORE";
-static const wchar_t *Lexer_ILIKE = L"ILIKE";
-static const wchar_t *Lexer_IMMEDIATE = L"IMMEDIATE";
-static const wchar_t *Lexer_IMMEDIATELY = L"IMMEDIATELY";
-static const wchar_t *Lexer_IMMUTABLE = L"IMMUTABLE";
-static const wchar_t *Lexer_IMPLEMENTATION = L"IMPLEMENTATION";
-static const wchar_t *Lexer_IMPLICIT = L"IMPLICIT";
-static const wchar_t *Lexer_IMPORT = L"IMPORT";
-static const wchar_t *Lexer_IN = L"IN";
-static const wchar_t *Lexer_INCLUDE = L"INCLUDE";
-static const wchar_t *Lexer_INCLUDING = L"INCLUDING";
-static const wchar_t *Lexer_INCREMENT = L"INCREMENT";
-static const wchar_t *Lexer_INDENT = L"INDENT";
-static const wchar_t *Lexer_INDEX = L"INDEX";
-static const wchar_t *Lexer_INDEXES = L"INDEXES";
-static const wchar_t *Lexer_INDICATOR = L"INDICATOR";
-static const wchar_t *Lexer_INHERIT = L"INHERIT";
-static const wchar_t *Lexer_INHERITS = L"INHERITS";
-static const wchar_t *Lexer_INITIALLY = L"INITIALLY";
-static const wchar_t *Lexer_INLINE = L"INLINE";
-static const wchar_t *Lexer_INNER = L"INNER";
-static const wchar_t *Lexer_INOUT = L"INOUT";
-static const wchar_t *Lexer_INPUT = L"INPUT";
-static const wchar_t *Lexer_INSENSITIVE = L"INSENSITIVE";
-static const wchar_t *Lexer_INSERT = L"INSERT";
-static const wchar_t *Lexer_INSTANCE = L"INSTANCE";
-static const wchar_t *Lexer_INSTANTIABLE = L"INSTANTIABLE";
-static const wchar_t *Lexer_INSTEAD = L"INSTEAD";
-static const wchar_t *Lexer_INT = L"INT";
-static const wchar_t *Lexer_INTEGER = L"INTEGER";
-static const wchar_t *Lexer_INTEGRITY = L"INTEGRITY";
-static const wchar_t *Lexer_INTERSECT = L"INTERSECT";
-static const wchar_t *Lexer_INTERSECTION = L"INTERSECTION";
-static const wchar_t *Lexer_INTERVAL = L"INTERVAL";
-static const wchar_t *Lexer_INTO = L"INTO";
-static const wchar_t *Lexer_INVOKER = L"INVOKER";
-static const wchar_t *Lexer_IS = L"IS";
-static const wchar_t *Lexer_ISNULL = L"ISNULL";
-static const wchar_t *Lexer_ISOLATION = L"ISOLATION";
-static const wchar_t *Lexer_JOIN = L"JOIN";
-static const wchar_t *Lexer_K = L"K";
-static const wchar_t *Lexer_KEY = L"KEY";
-static const wchar_t *Lexer_KEY_MEMBER = L"KEY_MEMBER";
-static const wchar_t *Lexer_KEY_TYPE = L"KEY_TYPE";
-static const wchar_t *Lexer_LABEL = L"LABEL";
-static const wchar_t *Lexer_LAG = L"LAG";
-static const wchar_t *Lexer_LANGUAGE = L"LANGUAGE";
-static const wchar_t *Lexer_LARGE = L"LARGE";
-static const wchar_t *Lexer_LAST = L"LAST";
-static const wchar_t *Lexer_LAST_VALUE = L"LAST_VALUE";
-static const wchar_t *Lexer_LATERAL = L"LATERAL";
-static const wchar_t *Lexer_LEAD = L"LEAD";
-static const wchar_t *Lexer_LEADING = L"LEADING";
-static const wchar_t *Lexer_LEAKPROOF = L"LEAKPROOF";
-static const wchar_t *Lexer_LEAST = L"LEAST";
-static const wchar_t *Lexer_LEFT = L"LEFT";
-static const wchar_t *Lexer_LENGTH = L"LENGTH";
-static const wchar_t *Lexer_LEVEL = L"LEVEL";
-static const wchar_t *Lexer_LIBRARY = L"LIBRARY";
-static const wchar_t *Lexer_LIKE = L"LIKE";
-static const wchar_t *Lexer_LIKE_REGEX = L"LIKE_REGEX";
-static const wchar_t *Lexer_LIMIT = L"LIMIT";
-static const wchar_t *Lexer_LINK = L"LINK";
-static const wchar_t *Lexer_LISTEN = L"LISTEN";
-static const wchar_t *Lexer_LN = L"LN";
-static const wchar_t *Lexer_LOAD = L"LOAD";
-static const wchar_t *Lexer_LOCAL = L"LOCAL";
-static const wchar_t *Lexer_LOCALTIME = L"LOCALTIME";
-static const wchar_t *Lexer_LOCALTIMESTAMP = L"LOCALTIMESTAMP";
-static const wchar_t *Lexer_LOCATION = L"LOCATION";
-static const wchar_t *Lexer_LOCATOR = L"LOCATOR";
-static const wchar_t *Lexer_LOCK = L"LOCK";
-static const wchar_t *Lexer_LOCKED = L"LOCKED";
-static const wchar_t *Lexer_LOGGED = L"LOGGED";
-static const wchar_t *Lexer_LOWER = L"LOWER";
-static const wchar_t *Lexer_M = L"M";
-static const wchar_t *Lexer_MAP = L"MAP";
-static const wchar_t *Lexer_MAPPING = L"MAPPING";
-static const wchar_t *Lexer_MATCH = L"MATCH";
-static const wchar_t *Lexer_MATCHED = L"MATCHED";
-static const wchar_t *Lexer_MATERIALIZED = L"MATERIALIZED";
-static const wchar_t *Lexer_MAX = L"MAX";
-static const wchar_t *Lexer_MAXVALUE = L"MAXVALUE";
-static const wchar_t *Lexer_MAX_CARDINALITY = L"MAX_CARDINALITY";
-static const wchar_t *Lexer_MEMBER = L"MEMBER";
-static const wchar_t *Lexer_MERGE = L"MERGE";
-static const wchar_t *Lexer_MESSAGE_LENGTH = L"MESSAGE_LENGTH";
-static const wchar_t *Lexer_MESSAGE_OCTET_LENGTH = L"MESSAGE_OCTET_LENGTH";
-static const wchar_t *Lexer_MESSAGE_TEXT = L"MESSAGE_TEXT";
-static const wchar_t *Lexer_METHOD = L"METHOD";
-static const wchar_t *Lexer_MIN = L"MIN";
-static const wchar_t *Lexer_MINUTE = L"MINUTE";
-static const wchar_t *Lexer_MINVALUE = L"MINVALUE";
-static const wchar_t *Lexer_MOD = L"MOD";
-static const wchar_t *Lexer_MODE = L"MODE";
-static const wchar_t *Lexer_MODIFIES = L"MODIFIES";
-static const wchar_t *Lexer_MODULE = L"MODULE";
-static const wchar_t *Lexer_MONTH = L"MONTH";
-static const wchar_t *Lexer_MORE = L"MORE";
-static const wchar_t *Lexer_MOVE = L"MOVE";
-static const wchar_t *Lexer_MULTISET = L"MULTISET";
-static const wchar_t *Lexer_MUMPS = L"MUMPS";
-static const wchar_t *Lexer_NAME = L"NAME";
-static const wchar_t *Lexer_NAMES = L"NAMES";
-static const wchar_t *Lexer_NAMESPACE = L"NAMESPACE";
-static const wchar_t *Lexer_NATIONAL = L"NATIONAL";
-static const wchar_t *Lexer_NATURAL = L"NATURAL";
-static const wchar_t *Lexer_NCHAR = L"NCHAR";
-static const wchar_t *Lexer_NCLOB = L"NCLOB";
-static const wchar_t *Lexer_NESTING = L"NESTING";
-static const wchar_t *Lexer_NEW = L"NEW";
-static const wchar_t *Lexer_NEXT = L"NEXT";
-static const wchar_t *Lexer_NFC = L"NFC";
-static const wchar_t *Lexer_NFD = L"NFD";
-static const wchar_t *Lexer_NFKC = L"NFKC";
-static const wchar_t *Lexer_NFKD = L"NFKD";
-static const wchar_t *Lexer_NIL = L"NIL";
-static const wchar_t *Lexer_NO = L"NO";
-static const wchar_t *Lexer_NONE = L"NONE";
-static const wchar_t *Lexer_NORMALIZE = L"NORMALIZE";
-static const wchar_t *Lexer_NORMALIZED = L"NORMALIZED";
-static const wchar_t *Lexer_NOT = L"NOT";
-static const wchar_t *Lexer_NOTHING = L"NOTHING";
-static const wchar_t *Lexer_NOTIFY = L"NOTIFY";
-static const wchar_t *Lexer_NOTNULL = L"NOTNULL";
-static const wchar_t *Lexer_NOWAIT = L"NOWAIT";
-static const wchar_t *Lexer_NTH_VALUE = L"NTH_VALUE";
-static const wchar_t *Lexer_NTILE = L"NTILE";
-static const wchar_t *Lexer_NULL = L"NULL";
-static const wchar_t *Lexer_NULLABLE = L"NULLABLE";
-static const wchar_t *Lexer_NULLIF = L"NULLIF";
-static const wchar_t *Lexer_NULLS = L"NULLS";
-static const wchar_t *Lexer_NUMBER = L"NUMBER";
-static const wchar_t *Lexer_NUMERIC = L"NUMERIC";
-static const wchar_t *Lexer_OBJECT = L"OBJECT";
-static const wchar_t *Lexer_OCCURRENCES_REGEX = L"OCCURRENCES_REGEX";
-static const wchar_t *Lexer_OCTETS = L"OCTETS";
-static const wchar_t *Lexer_OCTET_LENGTH = L"OCTET_LENGTH";
-static const wchar_t *Lexer_OF = L"OF";
-static const wchar_t *Lexer_OFF = L"OFF";
-static const wchar_t *Lexer_OFFSET = L"OFFSET";
-static const wchar_t *Lexer_OIDS = L"OIDS";
-static const wchar_t *Lexer_OLD = L"OLD";
-static const wchar_t *Lexer_ON = L"ON";
-static const wchar_t *Lexer_ONLY = L"ONLY";
-static const wchar_t *Lexer_OPEN = L"OPEN";
-static const wchar_t *Lexer_OPERATOR = L"OPERATOR";
-static const wchar_t *Lexer_OPTION = L"OPTION";
-static const wchar_t *Lexer_OPTIONS = L"OPTIONS";
-static const wchar_t *Lexer_OR = L"OR";
-static const wchar_t *Lexer_ORDER = L"ORDER";
-static const wchar_t *Lexer_ORDERING = L"ORDERING";
-static const wchar_t *Lexer_ORDINALITY = L"ORDINALITY";
-static const wchar_t *Lexer_OTHERS = L"OTHERS";
-static const wchar_t *Lexer_OUT = L"OUT";
-static const wchar_t *Lexer_OUTER = L"OUTER";
-static const wchar_t *Lexer_OUTPUT = L"OUTPUT";
-static const wchar_t *Lexer_OVER = L"OVER";
-static const wchar_t *Lexer_OVERLAPS = L"OVERLAPS";
-static const wchar_t *Lexer_OVERLAY = L"OVERLAY";
-static const wchar_t *Lexer_OVERRIDING = L"OVERRIDING";
-static const wchar_t *Lexer_OWNED = L"OWNED";
-static const wchar_t *Lexer_OWNER = L"OWNER";
-static const wchar_t *Lexer_P = L"P";
-static const wchar_t *Lexer_PAD = L"PAD";
-static const wchar_t *Lexer_PARALLEL = L"PARALLEL";
-static const wchar_t *Lexer_PARAMETER = L"PARAMETER";
-static const wchar_t *Lexer_PARAMETER_MODE = L"PARAMETER_MODE";
-static const wchar_t *Lexer_PARAMETER_NAME = L"PARAMETER_NAME";
-static const wchar_t *Lexer_PARAMETER_ORDINAL_POSITION = L"PARAMETER_ORDINAL_POSITION";
-static const wchar_t *Lexer_PARAMETER_SPECIFIC_CATALOG = L"PARAMETER_SPECIFIC_CATALOG";
-static const wchar_t *Lexer_PARAMETER_SPECIFIC_NAME = L"PARAMETER_SPECIFIC_NAME";
-static const wchar_t *Lexer_PARAMETER_SPECIFIC_SCHEMA = L"PARAMETER_SPECIFIC_SCHEMA";
-static const wchar_t *Lexer_PARSER = L"PARSER";
-static const wchar_t *Lexer_PARTIAL = L"PARTIAL";
-static const wchar_t *Lexer_PARTITION = L"PARTITION";
-static const wchar_t *Lexer_PASCAL = L"PASCAL";
-static const wchar_t *Lexer_PASSING = L"PASSING";
-static const wchar_t *Lexer_PASSTHROUGH = L"PASSTHROUGH";
-static const wchar_t *Lexer_PASSWORD = L"PASSWORD";
-static const wchar_t *Lexer_PATH = L"PATH";
-static const wchar_t *Lexer_PERCENT = L"PERCENT";
-static const wchar_t *Lexer_PERCENTILE_CONT = L"PERCENTILE_CONT";
-static const wchar_t *Lexer_PERCENTILE_DISC = L"PERCENTILE_DISC";
-static const wchar_t *Lexer_PERCENT_RANK = L"PERCENT_RANK";
-static const wchar_t *Lexer_PERIOD = L"PERIOD";
-static const wchar_t *Lexer_PERMISSION = L"PERMISSION";
-static const wchar_t *Lexer_PLACING = L"PLACING";
-static const wchar_t *Lexer_PLANS = L"PLANS";
-static const wchar_t *Lexer_PLI = L"PLI";
-static const wchar_t *Lexer_POLICY = L"POLICY";
-static const wchar_t *Lexer_PORTION = L"PORTION";
-static const wchar_t *Lexer_POSITION = L"POSITION";
-static const wchar_t *Lexer_POSITION_REGEX = L"POSITION_REGEX";
-static const wchar_t *Lexer_POWER = L"POWER";
-static const wchar_t *Lexer_PRECEDES = L"PRECEDES";
-static const wchar_t *Lexer_PRECEDING = L"PRECEDING";
-static const wchar_t *Lexer_PRECISION = L"PRECISION";
-static const wchar_t *Lexer_PREPARE = L"PREPARE";
-static const wchar_t *Lexer_PREPARED = L"PREPARED";
-static const wchar_t *Lexer_PRESERVE = L"PRESERVE";
-static const wchar_t *Lexer_PRIMARY = L"PRIMARY";
-static const wchar_t *Lexer_PRIOR = L"PRIOR";
-static const wchar_t *Lexer_PRIVILEGES = L"PRIVILEGES";
-static const wchar_t *Lexer_PROCEDURAL = L"PROCEDURAL";
-static const wchar_t *Lexer_PROCEDURE = L"PROCEDURE";
-static const wchar_t *Lexer_PROCEDURES = L"PROCEDURES";
-static const wchar_t *Lexer_PROGRAM = L"PROGRAM";
-static const wchar_t *Lexer_PUBLIC = L"PUBLIC";
-static const wchar_t *Lexer_PUBLICATION = L"PUBLICATION";
-static const wchar_t *Lexer_QUOTE = L"QUOTE";
-static const wchar_t *Lexer_RANGE = L"RANGE";
-static const wchar_t *Lexer_RANK = L"RANK";
-static const wchar_t *Lexer_READ = L"READ";
-static const wchar_t *Lexer_READS = L"READS";
-static const wchar_t *Lexer_REAL = L"REAL";
-static const wchar_t *Lexer_REASSIGN = L"REASSIGN";
-static const wchar_t *Lexer_RECHECK = L"RECHECK";
-static const wchar_t *Lexer_RECOVERY = L"RECOVERY";
-static const wchar_t *Lexer_RECURSIVE = L"RECURSIVE";
-static const wchar_t *Lexer_REF = L"REF";
-static const wchar_t *Lexer_REFERENCES = L"REFERENCES";
-static const wchar_t *Lexer_REFERENCING = L"REFERENCING";
-static const wchar_t *Lexer_REFRESH = L"REFRESH";
-static const wchar_t *Lexer_REGR_AVGX = L"REGR_AVGX";
-static const wchar_t *Lexer_REGR_AVGY = L"REGR_AVGY";
-static const wchar_t *Lexer_REGR_COUNT = L"REGR_COUNT";
-static const wchar_t *Lexer_REGR_INTERCEPT = L"REGR_INTERCEPT";
-static const wchar_t *Lexer_REGR_R2 = L"REGR_R2";
-static const wchar_t *Lexer_REGR_SLOPE = L"REGR_SLOPE";
-static const wchar_t *Lexer_REGR_SXX = L"REGR_SXX";
-static const wchar_t *Lexer_REGR_SXY = L"REGR_SXY";
-static const wchar_t *Lexer_REGR_SYY = L"REGR_SYY";
-static const wchar_t *Lexer_REINDEX = L"REINDEX";
-static const wchar_t *Lexer_RELATIVE = L"RELATIVE";
-static const wchar_t *Lexer_RELEASE = L"RELEASE";
-static const wchar_t *Lexer_RENAME = L"RENAME";
-static const wchar_t *Lexer_REPEATABLE = L"REPEATABLE";
-static const wchar_t *Lexer_REPLACE = L"REPLACE";
-static const wchar_t *Lexer_REPLICA = L"REPLICA";
-static const wchar_t *Lexer_REQUIRING = L"REQUIRING";
-static const wchar_t *Lexer_RESET = L"RESET";
-static const wchar_t *Lexer_RESPECT = L"RESPECT";
-static const wchar_t *Lexer_RESTART = L"RESTART";
-static const wchar_t *Lexer_RESTORE = L"RESTORE";
-static const wchar_t *Lexer_RESTRICT = L"RESTRICT";
-static const wchar_t *Lexer_RESULT = L"RESULT";
-static const wchar_t *Lexer_RETURN = L"RETURN";
-static const wchar_t *Lexer_RETURNED_CARDINALITY = L"RETURNED_CARDINALITY";
-static const wchar_t *Lexer_RETURNED_LENGTH = L"RETURNED_LENGTH";
-static const wchar_t *Lexer_RETURNED_OCTET_LENGTH = L"RETURNED_OCTET_LENGTH";
-static const wchar_t *Lexer_RETURNED_SQLSTATE = L"RETURNED_SQLSTATE";
-static const wchar_t *Lexer_RETURNING = L"RETURNING";
-static const wchar_t *Lexer_RETURNS = L"RETURNS";
-static const wchar_t *Lexer_REVOKE = L"REVOKE";
-static const wchar_t *Lexer_RIGHT = L"RIGHT";
-static const wchar_t *Lexer_ROLE = L"ROLE";
-static const wchar_t *Lexer_ROLLBACK = L"ROLLBACK";
-static const wchar_t *Lexer_ROLLUP = L"ROLLUP";
-static const wchar_t *Lexer_ROUTINE = L"ROUTINE";
-static const wchar_t *Lexer_ROUTINES = L"ROUTINES";
-static const wchar_t *Lexer_ROUTINE_CATALOG = L"ROUTINE_CATALOG";
-static const wchar_t *Lexer_ROUTINE_NAME = L"ROUTINE_NAME";
-static const wchar_t *Lexer_ROUTINE_SCHEMA = L"ROUTINE_SCHEMA";
-static const wchar_t *Lexer_ROW = L"ROW";
-static const wchar_t *Lexer_ROWS = L"ROWS";
-static const wchar_t *Lexer_ROW_COUNT = L"ROW_COUNT";
-static const wchar_t *Lexer_ROW_NUMBER = L"ROW_NUMBER";
-static const wchar_t *Lexer_RULE = L"RULE";
-static const wchar_t *Lexer_SAVEPOINT = L"SAVEPOINT";
-static const wchar_t *Lexer_SCALE = L"SCALE";
-static const wchar_t *Lexer_SCHEMA = L"SCHEMA";
-static const wchar_t *Lexer_SCHEMAS = L"SCHEMAS";
-static const wchar_t *Lexer_SCHEMA_NAME = L"SCHEMA_NAME";
-static const wchar_t *Lexer_SCOPE = L"SCOPE";
-static const wchar_t *Lexer_SCOPE_CATALOG = L"SCOPE_CATALOG";
-static const wchar_t *Lexer_SCOPE_NAME = L"SCOPE_NAME";
-static const wchar_t *Lexer_SCOPE_SCHEMA = L"SCOPE_SCHEMA";
-static const wchar_t *Lexer_SCROLL = L"SCROLL";
-static const wchar_t *Lexer_SEARCH = L"SEARCH";
-static const wchar_t *Lexer_SECOND = L"SECOND";
-static const wchar_t *Lexer_SECTION = L"SECTION";
-static const wchar_t *Lexer_SECURITY = L"SECURITY";
-static const wchar_t *Lexer_SELECT = L"SELECT";
-static const wchar_t *Lexer_SELECTIVE = L"SELECTIVE";
-static const wchar_t *Lexer_SELF = L"SELF";
-static const wchar_t *Lexer_SENSITIVE = L"SENSITIVE";
-static const wchar_t *Lexer_SEQUENCE = L"SEQUENCE";
-static const wchar_t *Lexer_SEQUENCES = L"SEQUENCES";
-static const wchar_t *Lexer_SERIALIZABLE = L"SERIALIZABLE";
-static const wchar_t *Lexer_SERVER = L"SERVER";
-static const wchar_t *Lexer_SERVER_NAME = L"SERVER_NAME";
-static const wchar_t *Lexer_SESSION = L"SESSION";
-static const wchar_t *Lexer_SESSION_USER = L"SESSION_USER";
-static const wchar_t *Lexer_SET = L"SET";
-static const wchar_t *Lexer_SETOF = L"SETOF";
-static const wchar_t *Lexer_SETS = L"SETS";
-static const wchar_t *Lexer_SHARE = L"SHARE";
-static const wchar_t *Lexer_SHOW = L"SHOW";
-static const wchar_t *Lexer_SIMILAR = L"SIMILAR";
-static const wchar_t *Lexer_SIMPLE = L"SIMPLE";
-static const wchar_t *Lexer_SIZE = L"SIZE";
-static const wchar_t *Lexer_SKIP = L"SKIP";
-static const wchar_t *Lexer_SMALLINT = L"SMALLINT";
-static const wchar_t *Lexer_SNAPSHOT = L"SNAPSHOT";
-static const wchar_t *Lexer_SOME = L"SOME";
-static const wchar_t *Lexer_SOURCE = L"SOURCE";
-static const wchar_t *Lexer_SPACE = L"SPACE";
-static const wchar_t *Lexer_SPECIFIC = L"SPECIFIC";
-static const wchar_t *Lexer_SPECIFICTYPE = L"SPECIFICTYPE";
-static const wchar_t *Lexer_SPECIFIC_NAME = L"SPECIFIC_NAME";
-static const wchar_t *Lexer_SQL = L"SQL";
-static const wchar_t *Lexer_SQLCODE = L"SQLCODE";
-static const wchar_t *Lexer_SQLERROR = L"SQLERROR";
-static const wchar_t *Lexer_SQLEXCEPTION = L"SQLEXCEPTION";
-static const wchar_t *Lexer_SQLSTATE = L"SQLSTATE";
-static const wchar_t *Lexer_SQLWARNING = L"SQLWARNING";
-static const wchar_t *Lexer_SQRT = L"SQRT";
-static const wchar_t *Lexer_STABLE = L"STABLE";
-static const wchar_t *Lexer_STANDALONE = L"STANDALONE";
-static const wchar_t *Lexer_START = L"START";
-static const wchar_t *Lexer_STATE = L"STATE";
-static const wchar_t *Lexer_STATEMENT = L"STATEMENT";
-static const wchar_t *Lexer_STATIC = L"STATIC";
-static const wchar_t *Lexer_STATISTICS = L"STATISTICS";
-static const wchar_t *Lexer_STDDEV_POP = L"STDDEV_POP";
-static const wchar_t *Lexer_STDDEV_SAMP = L"STDDEV_SAMP";
-static const wchar_t *Lexer_STDIN = L"STDIN";
-static const wchar_t *Lexer_STDOUT = L"STDOUT";
-static const wchar_t *Lexer_STORAGE = L"STORAGE";
-static const wchar_t *Lexer_STRICT = L"STRICT";
-static const wchar_t *Lexer_STRIP = L"STRIP";
-static const wchar_t *Lexer_STRUCTURE = L"STRUCTURE";
-static const wchar_t *Lexer_STYLE = L"STYLE";
-static const wchar_t *Lexer_SUBCLASS_ORIGIN = L"SUBCLASS_ORIGIN";
-static const wchar_t *Lexer_SUBMULTISET = L"SUBMULTISET";
-static const wchar_t *Lexer_SUBSCRIPTION = L"SUBSCRIPTION";
-static const wchar_t *Lexer_SUBSTRING = L"SUBSTRING";
-static const wchar_t *Lexer_SUBSTRING_REGEX = L"SUBSTRING_REGEX";
-static const wchar_t *Lexer_SUCCEEDS = L"SUCCEEDS";
-static const wchar_t *Lexer_SUM = L"SUM";
-static const wchar_t *Lexer_SYMMETRIC = L"SYMMETRIC";
-static const wchar_t *Lexer_SYSID = L"SYSID";
-static const wchar_t *Lexer_SYSTEM = L"SYSTEM";
-static const wchar_t *Lexer_SYSTEM_TIME = L"SYSTEM_TIME";
-static const wchar_t *Lexer_SYSTEM_USER = L"SYSTEM_USER";
-static const wchar_t *Lexer_T = L"T";
-static const wchar_t *Lexer_TABLE = L"TABLE";
-static const wchar_t *Lexer_TABLES = L"TABLES";
-static const wchar_t *Lexer_TABLESAMPLE = L"TABLESAMPLE";
-static const wchar_t *Lexer_TABLESPACE = L"TABLESPACE";
-static const wchar_t *Lexer_TABLE_NAME = L"TABLE_NAME";
-static const wchar_t *Lexer_TEMP = L"TEMP";
-static const wchar_t *Lexer_TEMPLATE = L"TEMPLATE";
-static const wchar_t *Lexer_TEMPORARY = L"TEMPORARY";
-static const wchar_t *Lexer_TEXT = L"TEXT";
-static const wchar_t *Lexer_THEN = L"THEN";
-static const wchar_t *Lexer_TIES = L"TIES";
-static const wchar_t *Lexer_TIME = L"TIME";
-static const wchar_t *Lexer_TIMESTAMP = L"TIMESTAMP";
-static const wchar_t *Lexer_TIMEZONE_HOUR = L"TIMEZONE_HOUR";
-static const wchar_t *Lexer_TIMEZONE_MINUTE = L"TIMEZONE_MINUTE";
-static const wchar_t *Lexer_TO = L"TO";
-static const wchar_t *Lexer_TOKEN = L"TOKEN";
-static const wchar_t *Lexer_TOP_LEVEL_COUNT = L"TOP_LEVEL_COUNT";
-static const wchar_t *Lexer_TRAILING = L"TRAILING";
-static const wchar_t *Lexer_TRANSACTION = L"TRANSACTION";
-static const wchar_t *Lexer_TRANSACTIONS_COMMITTED = L"TRANSACTIONS_COMMITTED";
-static const wchar_t *Lexer_TRANSACTIONS_ROLLED_BACK = L"TRANSACTIONS_ROLLED_BACK";
-static const wchar_t *Lexer_TRANSACTION_ACTIVE = L"TRANSACTION_ACTIVE";
-static const wchar_t *Lexer_TRANSFORM = L"TRANSFORM";
-static const wchar_t *Lexer_TRANSFORMS = L"TRANSFORMS";
-static const wchar_t *Lexer_TRANSLATE = L"TRANSLATE";
-static const wchar_t *Lexer_TRANSLATE_REGEX = L"TRANSLATE_REGEX";
-static const wchar_t *Lexer_TRANSLATION = L"TRANSLATION";
-static const wchar_t *Lexer_TREAT = L"TREAT";
-static const wchar_t *Lexer_TRIGGER = L"TRIGGER";
-static const wchar_t *Lexer_TRIGGER_CATALOG = L"TRIGGER_CATALOG";
-static const wchar_t *Lexer_TRIGGER_NAME = L"TRIGGER_NAME";
-static const wchar_t *Lexer_TRIGGER_SCHEMA = L"TRIGGER_SCHEMA";
-static const wchar_t *Lexer_TRIM = L"TRIM";
-static const wchar_t *Lexer_TRIM_ARRAY = L"TRIM_ARRAY";
-static const wchar_t *Lexer_TRUE = L"TRUE";
-static const wchar_t *Lexer_TRUNCATE = L"TRUNCATE";
-static const wchar_t *Lexer_TRUSTED = L"TRUSTED";
-static const wchar_t *Lexer_TYPE = L"TYPE";
-static const wchar_t *Lexer_TYPES = L"TYPES";
-static const wchar_t *Lexer_UESCAPE = L"UESCAPE";
-static const wchar_t *Lexer_UNBOUNDED = L"UNBOUNDED";
-static const wchar_t *Lexer_UNCOMMITTED = L"UNCOMMITTED";
-static const wchar_t *Lexer_UNDER = L"UNDER";
-static const wchar_t *Lexer_UNENCRYPTED = L"UNENCRYPTED";
-static const wchar_t *Lexer_UNION = L"UNION";
-static const wchar_t *Lexer_UNIQUE = L"UNIQUE";
-static const wchar_t *Lexer_UNKNOWN = L"UNKNOWN";
-static const wchar_t *Lexer_UNLINK = L"UNLINK";
-static const wchar_t *Lexer_UNLISTEN = L"UNLISTEN";
-static const wchar_t *Lexer_UNLOGGED = L"UNLOGGED";
-static const wchar_t *Lexer_UNNAMED = L"UNNAMED";
-static const wchar_t *Lexer_UNNEST = L"UNNEST";
-static const wchar_t *Lexer_UNTIL = L"UNTIL";
-static const wchar_t *Lexer_UNTYPED = L"UNTYPED";
-static const wchar_t *Lexer_UPDATE = L"UPDATE";
-static const wchar_t *Lexer_UPPER = L"UPPER";
-static const wchar_t *Lexer_URI = L"URI";
-static const wchar_t *Lexer_USAGE = L"USAGE";
-static const wchar_t *Lexer_USER = L"USER";
-static const wchar_t *Lexer_USER_DEFINED_TYPE_CATALOG = L"USER_DEFINED_TYPE_CATALOG";
-static const wchar_t *Lexer_USER_DEFINED_TYPE_CODE = L"USER_DEFINED_TYPE_CODE";
-static const wchar_t *Lexer_USER_DEFINED_TYPE_NAME = L"USER_DEFINED_TYPE_NAME";
-static const wchar_t *Lexer_USER_DEFINED_TYPE_SCHEMA = L"USER_DEFINED_TYPE_SCHEMA";
-static const wchar_t *Lexer_USING = L"USING";
-static const wchar_t *Lexer_VACUUM = L"VACUUM";
-static const wchar_t *Lexer_VALID = L"VALID";
-static const wchar_t *Lexer_VALIDATE = L"VALIDATE";
-static const wchar_t *Lexer_VALIDATOR = L"VALIDATOR";
-static const wchar_t *Lexer_VALUE = L"VALUE";
-static const wchar_t *Lexer_VALUES = L"VALUES";
-static const wchar_t *Lexer_VALUE_OF = L"VALUE_OF";
-static const wchar_t *Lexer_VARBINARY = L"VARBINARY";
-static const wchar_t *Lexer_VARCHAR = L"VARCHAR";
-static const wchar_t *Lexer_VARIADIC = L"VARIADIC";
-static const wchar_t *Lexer_VARYING = L"VARYING";
-static const wchar_t *Lexer_VAR_POP = L"VAR_POP";
-static const wchar_t *Lexer_VAR_SAMP = L"VAR_SAMP";
-static const wchar_t *Lexer_VERBOSE = L"VERBOSE";
-static const wchar_t *Lexer_VERSION = L"VERSION";
-static const wchar_t *Lexer_VERSIONING = L"VERSIONING";
-static const wchar_t *Lexer_VIEW = L"VIEW";
-static const wchar_t *Lexer_VIEWS = L"VIEWS";
-static const wchar_t *Lexer_VOLATILE = L"VOLATILE";
-static const wchar_t *Lexer_WHEN = L"WHEN";
-static const wchar_t *Lexer_WHENEVER = L"WHENEVER";
-static const wchar_t *Lexer_WHERE = L"WHERE";
-static const wchar_t *Lexer_WHITESPACE = L"WHITESPACE";
-static const wchar_t *Lexer_WIDTH_BUCKET = L"WIDTH_BUCKET";
-static const wchar_t *Lexer_WINDOW = L"WINDOW";
-static const wchar_t *Lexer_WITH = L"WITH";
-static const wchar_t *Lexer_WITHIN = L"WITHIN";
-static const wchar_t *Lexer_WITHOUT = L"WITHOUT";
-static const wchar_t *Lexer_WORK = L"WORK";
-static const wchar_t *Lexer_WRAPPER = L"WRAPPER";
-static const wchar_t *Lexer_WRITE = L"WRITE";
-static const wchar_t *Lexer_XML = L"XML";
-static const wchar_t *Lexer_XMLAGG = L"XMLAGG";
-static const wchar_t *Lexer_XMLATTRIBUTES = L"XMLATTRIBUTES";
-static const wchar_t *Lexer_XMLBINARY = L"XMLBINARY";
-static const wchar_t *Lexer_XMLCAST = L"XMLCAST";
-static const wchar_t *Lexer_XMLCOMMENT = L"XMLCOMMENT";
-static const wchar_t *Lexer_XMLCONCAT = L"XMLCONCAT";
-static const wchar_t *Lexer_XMLDECLARATION = L"XMLDECLARATION";
-static const wchar_t *Lexer_XMLDOCUMENT = L"XMLDOCUMENT";
-static const wchar_t *Lexer_XMLELEMENT = L"XMLELEMENT";
-static const wchar_t *Lexer_XMLEXISTS = L"XMLEXISTS";
-static const wchar_t *Lexer_XMLFOREST = L"XMLFOREST";
-static const wchar_t *Lexer_XMLITERATE = L"XMLITERATE";
-static const wchar_t *Lexer_XMLNAMESPACES = L"XMLNAMESPACES";
-static const wchar_t *Lexer_XMLPARSE = L"XMLPARSE";
-static const wchar_t *Lexer_XMLPI = L"XMLPI";
-static const wchar_t *Lexer_XMLQUERY = L"XMLQUERY";
-static const wchar_t *Lexer_XMLROOT = L"XMLROOT";
-static const wchar_t *Lexer_XMLSCHEMA = L"XMLSCHEMA";
-static const wchar_t *Lexer_XMLSERIALIZE = L"XMLSERIALIZE";
-static const wchar_t *Lexer_XMLTABLE = L"XMLTABLE";
-static const wchar_t *Lexer_XMLTEXT = L"XMLTEXT";
-static const wchar_t *Lexer_XMLVALIDATE = L"XMLVALIDATE";
-static const wchar_t *Lexer_YEAR = L"YEAR";
-static const wchar_t *Lexer_YES = L"YES";
-static const wchar_t *Lexer_ZONE = L"ZONE";
+static const unsigned short Lexer_KEYWORD_BUCKETS[LEXER_KEYWORD_MAX + 2] = {
+    0, 0, 7, 24, 68, 148, 238, 328, 430, 508, 579, 627, 657, 681, 693, 707, 723,
+    728, 734, 738, 738, 741, 746, 750, 751, 753, 755, 757, 758, 758, 758, 758, 759,
+    760
+};
 
-static void init_keywords() {
-    if (Lexer_KEYWORDS != NULL)
-        return;
-    Lexer_KEYWORDS = (const wchar_t **) malloc(sizeof(char *) * 760);
-    memset(Lexer_KEYWORDS, 0, sizeof(char *) * 760);
-
-    Lexer_KEYWORDS[0] = Lexer_A;
-    Lexer_KEYWORDS[1] = Lexer_ABORT;
-    Lexer_KEYWORDS[2] = Lexer_ABS;
-    Lexer_KEYWORDS[3] = Lexer_ABSENT;
-    Lexer_KEYWORDS[4] = Lexer_ABSOLUTE;
-    Lexer_KEYWORDS[5] = Lexer_ACCESS;
-    Lexer_KEYWORDS[6] = Lexer_ACCORDING;
-    Lexer_KEYWORDS[7] = Lexer_ACTION;
-    Lexer_KEYWORDS[8] = Lexer_ADA;
-    Lexer_KEYWORDS[9] = Lexer_ADD;
-    Lexer_KEYWORDS[10] = Lexer_ADMIN;
-    Lexer_KEYWORDS[11] = Lexer_AFTER;
-    Lexer_KEYWORDS[12] = Lexer_AGGREGATE;
-    Lexer_KEYWORDS[13] = Lexer_ALL;
-    Lexer_KEYWORDS[14] = Lexer_ALLOCATE;
-    Lexer_KEYWORDS[15] = Lexer_ALSO;
-    Lexer_KEYWORDS[16] = Lexer_ALTER;
-    Lexer_KEYWORDS[17] = Lexer_ALWAYS;
-    Lexer_KEYWORDS[18] = Lexer_ANALYSE;
-    Lexer_KEYWORDS[19] = Lexer_ANALYZE;
-    Lexer_KEYWORDS[20] = Lexer_AND;
-    Lexer_KEYWORDS[21] = Lexer_ANY;
-    Lexer_KEYWORDS[22] = Lexer_ARE;
-    Lexer_KEYWORDS[23] = Lexer_ARRAY;
-    Lexer_KEYWORDS[24] = Lexer_ARRAY_AGG;
-    Lexer_KEYWORDS[25] = Lexer_ARRAY_MAX_CARDINALITY;
-    Lexer_KEYWORDS[26] = Lexer_AS;
-    Lexer_KEYWORDS[27] = Lexer_ASC;
-    Lexer_KEYWORDS[28] = Lexer_ASENSITIVE;
-    Lexer_KEYWORDS[29] = Lexer_ASSERTION;
-    Lexer_KEYWORDS[30] = Lexer_ASSIGNMENT;
-    Lexer_KEYWORDS[31] = Lexer_ASYMMETRIC;
-    Lexer_KEYWORDS[32] = Lexer_AT;
-    Lexer_KEYWORDS[33] = Lexer_ATOMIC;
-    Lexer_KEYWORDS[34] = Lexer_ATTACH;
-    Lexer_KEYWORDS[35] = Lexer_ATTRIBUTE;
-    Lexer_KEYWORDS[36] = Lexer_ATTRIBUTES;
-    Lexer_KEYWORDS[37] = Lexer_AUTHORIZATION;
-    Lexer_KEYWORDS[38] = Lexer_AVG;
-    Lexer_KEYWORDS[39] = Lexer_BACKWARD;
-    Lexer_KEYWORDS[40] = Lexer_BASE64;
-    Lexer_KEYWORDS[41] = Lexer_BEFORE;
-    Lexer_KEYWORDS[42] = Lexer_BEGIN;
-    Lexer_KEYWORDS[43] = Lexer_BEGIN_FRAME;
-    Lexer_KEYWORDS[44] = Lexer_BEGIN_PARTITION;
-    Lexer_KEYWORDS[45] = Lexer_BERNOULLI;
-    Lexer_KEYWORDS[46] = Lexer_BETWEEN;
-    Lexer_KEYWORDS[47] = Lexer_BIGINT;
-    Lexer_KEYWORDS[48] = Lexer_BINARY;
-    Lexer_KEYWORDS[49] = Lexer_BIT;
-    Lexer_KEYWORDS[50] = Lexer_BIT_LENGTH;
-    Lexer_KEYWORDS[51] = Lexer_BLOB;
-    Lexer_KEYWORDS[52] = Lexer_BLOCKED;
-    Lexer_KEYWORDS[53] = Lexer_BOM;
-    Lexer_KEYWORDS[54] = Lexer_BOOLEAN;
-    Lexer_KEYWORDS[55] = Lexer_BOTH;
-    Lexer_KEYWORDS[56] = Lexer_BREADTH;
-    Lexer_KEYWORDS[57] = Lexer_BY;
-    Lexer_KEYWORDS[58] = Lexer_C;
-    Lexer_KEYWORDS[59] = Lexer_CACHE;
-    Lexer_KEYWORDS[60] = Lexer_CALL;
-    Lexer_KEYWORDS[61] = Lexer_CALLED;
-    Lexer_KEYWORDS[62] = Lexer_CARDINALITY;
-    Lexer_KEYWORDS[63] = Lexer_CASCADE;
-    Lexer_KEYWORDS[64] = Lexer_CASCADED;
-    Lexer_KEYWORDS[65] = Lexer_CASE;
-    Lexer_KEYWORDS[66] = Lexer_CAST;
-    Lexer_KEYWORDS[67] = Lexer_CATALOG;
-    Lexer_KEYWORDS[68] = Lexer_CATALOG_NAME;
-    Lexer_KEYWORDS[69] = Lexer_CEIL;
-    Lexer_KEYWORDS[70] = Lexer_CEILING;
-    Lexer_KEYWORDS[71] = Lexer_CHAIN;
-    Lexer_KEYWORDS[72] = Lexer_CHAR;
-    Lexer_KEYWORDS[73] = Lexer_CHARACTER;
-    Lexer_KEYWORDS[74] = Lexer_CHARACTERISTICS;
-    Lexer_KEYWORDS[75] = Lexer_CHARACTERS;
-    Lexer_KEYWORDS[76] = Lexer_CHARACTER_LENGTH;
-    Lexer_KEYWORDS[77] = Lexer_CHARACTER_SET_CATALOG;
-    Lexer_KEYWORDS[78] = Lexer_CHARACTER_SET_NAME;
-    Lexer_KEYWORDS[79] = Lexer_CHARACTER_SET_SCHEMA;
-    Lexer_KEYWORDS[80] = Lexer_CHAR_LENGTH;
-    Lexer_KEYWORDS[81] = Lexer_CHECK;
-    Lexer_KEYWORDS[82] = Lexer_CHECKPOINT;
-    Lexer_KEYWORDS[83] = Lexer_CLASS;
-    Lexer_KEYWORDS[84] = Lexer_CLASS_ORIGIN;
-    Lexer_KEYWORDS[85] = Lexer_CLOB;
-    Lexer_KEYWORDS[86] = Lexer_CLOSE;
-    Lexer_KEYWORDS[87] = Lexer_CLUSTER;
-    Lexer_KEYWORDS[88] = Lexer_COALESCE;
-    Lexer_KEYWORDS[89] = Lexer_COBOL;
-    Lexer_KEYWORDS[90] = Lexer_COLLATE;
-    Lexer_KEYWORDS[91] = Lexer_COLLATION;
-    Lexer_KEYWORDS[92] = Lexer_COLLATION_CATALOG;
-    Lexer_KEYWORDS[93] = Lexer_COLLATION_NAME;
-    Lexer_KEYWORDS[94] = Lexer_COLLATION_SCHEMA;
-    Lexer_KEYWORDS[95] = Lexer_COLLECT;
-    Lexer_KEYWORDS[96] = Lexer_COLUMN;
-    Lexer_KEYWORDS[97] = Lexer_COLUMNS;
-    Lexer_KEYWORDS[98] = Lexer_COLUMN_NAME;
-    Lexer_KEYWORDS[99] = Lexer_COMMAND_FUNCTION;
-    Lexer_KEYWORDS[100] = Lexer_COMMAND_FUNCTION_CODE;
-    Lexer_KEYWORDS[101] = Lexer_COMMENT;
-    Lexer_KEYWORDS[102] = Lexer_COMMENTS;
-    Lexer_KEYWORDS[103] = Lexer_COMMIT;
-    Lexer_KEYWORDS[104] = Lexer_COMMITTED;
-    Lexer_KEYWORDS[105] = Lexer_CONCURRENTLY;
-    Lexer_KEYWORDS[106] = Lexer_CONDITION;
-    Lexer_KEYWORDS[107] = Lexer_CONDITION_NUMBER;
-    Lexer_KEYWORDS[108] = Lexer_CONFIGURATION;
-    Lexer_KEYWORDS[109] = Lexer_CONFLICT;
-    Lexer_KEYWORDS[110] = Lexer_CONNECT;
-    Lexer_KEYWORDS[111] = Lexer_CONNECTION;
-    Lexer_KEYWORDS[112] = Lexer_CONNECTION_NAME;
-    Lexer_KEYWORDS[113] = Lexer_CONSTRAINT;
-    Lexer_KEYWORDS[114] = Lexer_CONSTRAINTS;
-    Lexer_KEYWORDS[115] = Lexer_CONSTRAINT_CATALOG;
-    Lexer_KEYWORDS[116] = Lexer_CONSTRAINT_NAME;
-    Lexer_KEYWORDS[117] = Lexer_CONSTRAINT_SCHEMA;
-    Lexer_KEYWORDS[118] = Lexer_CONSTRUCTOR;
-    Lexer_KEYWORDS[119] = Lexer_CONTAINS;
-    Lexer_KEYWORDS[120] = Lexer_CONTENT;
-    Lexer_KEYWORDS[121] = Lexer_CONTINUE;
-    Lexer_KEYWORDS[122] = Lexer_CONTROL;
-    Lexer_KEYWORDS[123] = Lexer_CONVERSION;
-    Lexer_KEYWORDS[124] = Lexer_CONVERT;
-    Lexer_KEYWORDS[125] = Lexer_COPY;
-    Lexer_KEYWORDS[126] = Lexer_CORR;
-    Lexer_KEYWORDS[127] = Lexer_CORRESPONDING;
-    Lexer_KEYWORDS[128] = Lexer_COST;
-    Lexer_KEYWORDS[129] = Lexer_COUNT;
-    Lexer_KEYWORDS[130] = Lexer_COVAR_POP;
-    Lexer_KEYWORDS[131] = Lexer_COVAR_SAMP;
-    Lexer_KEYWORDS[132] = Lexer_CREATE;
-    Lexer_KEYWORDS[133] = Lexer_CROSS;
-    Lexer_KEYWORDS[134] = Lexer_CSV;
-    Lexer_KEYWORDS[135] = Lexer_CUBE;
-    Lexer_KEYWORDS[136] = Lexer_CUME_DIST;
-    Lexer_KEYWORDS[137] = Lexer_CURRENT;
-    Lexer_KEYWORDS[138] = Lexer_CURRENT_CATALOG;
-    Lexer_KEYWORDS[139] = Lexer_CURRENT_DATE;
-    Lexer_KEYWORDS[140] = Lexer_CURRENT_DEFAULT_TRANSFORM_GROUP;
-    Lexer_KEYWORDS[141] = Lexer_CURRENT_PATH;
-    Lexer_KEYWORDS[142] = Lexer_CURRENT_ROLE;
-    Lexer_KEYWORDS[143] = Lexer_CURRENT_ROW;
-    Lexer_KEYWORDS[144] = Lexer_CURRENT_SCHEMA;
-    Lexer_KEYWORDS[145] = Lexer_CURRENT_TIME;
-    Lexer_KEYWORDS[146] = Lexer_CURRENT_TIMESTAMP;
-    Lexer_KEYWORDS[147] = Lexer_CURRENT_TRANSFORM_GROUP_FOR_TYPE;
-    Lexer_KEYWORDS[148] = Lexer_CURRENT_USER;
-    Lexer_KEYWORDS[149] = Lexer_CURSOR;
-    Lexer_KEYWORDS[150] = Lexer_CURSOR_NAME;
-    Lexer_KEYWORDS[151] = Lexer_CYCLE;
-    Lexer_KEYWORDS[152] = Lexer_DATA;
-    Lexer_KEYWORDS[153] = Lexer_DATABASE;
-    Lexer_KEYWORDS[154] = Lexer_DATALINK;
-    Lexer_KEYWORDS[155] = Lexer_DATE;
-    Lexer_KEYWORDS[156] = Lexer_DATETIME_INTERVAL_CODE;
-    Lexer_KEYWORDS[157] = Lexer_DATETIME_INTERVAL_PRECISION;
-    Lexer_KEYWORDS[158] = Lexer_DAY;
-    Lexer_KEYWORDS[159] = Lexer_DB;
-    Lexer_KEYWORDS[160] = Lexer_DEALLOCATE;
-    Lexer_KEYWORDS[161] = Lexer_DEC;
-    Lexer_KEYWORDS[162] = Lexer_DECIMAL;
-    Lexer_KEYWORDS[163] = Lexer_DECLARE;
-    Lexer_KEYWORDS[164] = Lexer_DEFAULT;
-    Lexer_KEYWORDS[165] = Lexer_DEFAULTS;
-    Lexer_KEYWORDS[166] = Lexer_DEFERRABLE;
-    Lexer_KEYWORDS[167] = Lexer_DEFERRED;
-    Lexer_KEYWORDS[168] = Lexer_DEFINED;
-    Lexer_KEYWORDS[169] = Lexer_DEFINER;
-    Lexer_KEYWORDS[170] = Lexer_DEGREE;
-    Lexer_KEYWORDS[171] = Lexer_DELETE;
-    Lexer_KEYWORDS[172] = Lexer_DELIMITER;
-    Lexer_KEYWORDS[173] = Lexer_DELIMITERS;
-    Lexer_KEYWORDS[174] = Lexer_DENSE_RANK;
-    Lexer_KEYWORDS[175] = Lexer_DEPENDS;
-    Lexer_KEYWORDS[176] = Lexer_DEPTH;
-    Lexer_KEYWORDS[177] = Lexer_DEREF;
-    Lexer_KEYWORDS[178] = Lexer_DERIVED;
-    Lexer_KEYWORDS[179] = Lexer_DESC;
-    Lexer_KEYWORDS[180] = Lexer_DESCRIBE;
-    Lexer_KEYWORDS[181] = Lexer_DESCRIPTOR;
-    Lexer_KEYWORDS[182] = Lexer_DETACH;
-    Lexer_KEYWORDS[183] = Lexer_DETERMINISTIC;
-    Lexer_KEYWORDS[184] = Lexer_DIAGNOSTICS;
-    Lexer_KEYWORDS[185] = Lexer_DICTIONARY;
-    Lexer_KEYWORDS[186] = Lexer_DISABLE;
-    Lexer_KEYWORDS[187] = Lexer_DISCARD;
-    Lexer_KEYWORDS[188] = Lexer_DISCONNECT;
-    Lexer_KEYWORDS[189] = Lexer_DISPATCH;
-    Lexer_KEYWORDS[190] = Lexer_DISTINCT;
-    Lexer_KEYWORDS[191] = Lexer_DLNEWCOPY;
-    Lexer_KEYWORDS[192] = Lexer_DLPREVIOUSCOPY;
-    Lexer_KEYWORDS[193] = Lexer_DLURLCOMPLETE;
-    Lexer_KEYWORDS[194] = Lexer_DLURLCOMPLETEONLY;
-    Lexer_KEYWORDS[195] = Lexer_DLURLCOMPLETEWRITE;
-    Lexer_KEYWORDS[196] = Lexer_DLURLPATH;
-    Lexer_KEYWORDS[197] = Lexer_DLURLPATHONLY;
-    Lexer_KEYWORDS[198] = Lexer_DLURLPATHWRITE;
-    Lexer_KEYWORDS[199] = Lexer_DLURLSCHEME;
-    Lexer_KEYWORDS[200] = Lexer_DLURLSERVER;
-    Lexer_KEYWORDS[201] = Lexer_DLVALUE;
-    Lexer_KEYWORDS[202] = Lexer_DO;
-    Lexer_KEYWORDS[203] = Lexer_DOCUMENT;
-    Lexer_KEYWORDS[204] = Lexer_DOMAIN;
-    Lexer_KEYWORDS[205] = Lexer_DOUBLE;
-    Lexer_KEYWORDS[206] = Lexer_DROP;
-    Lexer_KEYWORDS[207] = Lexer_DYNAMIC;
-    Lexer_KEYWORDS[208] = Lexer_DYNAMIC_FUNCTION;
-    Lexer_KEYWORDS[209] = Lexer_DYNAMIC_FUNCTION_CODE;
-    Lexer_KEYWORDS[210] = Lexer_EACH;
-    Lexer_KEYWORDS[211] = Lexer_ELEMENT;
-    Lexer_KEYWORDS[212] = Lexer_ELSE;
-    Lexer_KEYWORDS[213] = Lexer_EMPTY;
-    Lexer_KEYWORDS[214] = Lexer_ENABLE;
-    Lexer_KEYWORDS[215] = Lexer_ENCODING;
-    Lexer_KEYWORDS[216] = Lexer_ENCRYPTED;
-    Lexer_KEYWORDS[217] = Lexer_END;
-    Lexer_KEYWORDS[218] = Lexer_END_EXEC;
-    Lexer_KEYWORDS[219] = Lexer_END_FRAME;
-    Lexer_KEYWORDS[220] = Lexer_END_PARTITION;
-    Lexer_KEYWORDS[221] = Lexer_ENFORCED;
-    Lexer_KEYWORDS[222] = Lexer_ENUM;
-    Lexer_KEYWORDS[223] = Lexer_EQUALS;
-    Lexer_KEYWORDS[224] = Lexer_ESCAPE;
-    Lexer_KEYWORDS[225] = Lexer_EVENT;
-    Lexer_KEYWORDS[226] = Lexer_EVERY;
-    Lexer_KEYWORDS[227] = Lexer_EXCEPT;
-    Lexer_KEYWORDS[228] = Lexer_EXCEPTION;
-    Lexer_KEYWORDS[229] = Lexer_EXCLUDE;
-    Lexer_KEYWORDS[230] = Lexer_EXCLUDING;
-    Lexer_KEYWORDS[231] = Lexer_EXCLUSIVE;
-    Lexer_KEYWORDS[232] = Lexer_EXEC;
-    Lexer_KEYWORDS[233] = Lexer_EXECUTE;
-    Lexer_KEYWORDS[234] = Lexer_EXISTS;
-    Lexer_KEYWORDS[235] = Lexer_EXP;
-    Lexer_KEYWORDS[236] = Lexer_EXPLAIN;
-    Lexer_KEYWORDS[237] = Lexer_EXPRESSION;
-    Lexer_KEYWORDS[238] = Lexer_EXTENSION;
-    Lexer_KEYWORDS[239] = Lexer_EXTERNAL;
-    Lexer_KEYWORDS[240] = Lexer_EXTRACT;
-    Lexer_KEYWORDS[241] = Lexer_FALSE;
-    Lexer_KEYWORDS[242] = Lexer_FAMILY;
-    Lexer_KEYWORDS[243] = Lexer_FETCH;
-    Lexer_KEYWORDS[244] = Lexer_FILE;
-    Lexer_KEYWORDS[245] = Lexer_FILTER;
-    Lexer_KEYWORDS[246] = Lexer_FINAL;
-    Lexer_KEYWORDS[247] = Lexer_FIRST;
-    Lexer_KEYWORDS[248] = Lexer_FIRST_VALUE;
-    Lexer_KEYWORDS[249] = Lexer_FLAG;
-    Lexer_KEYWORDS[250] = Lexer_FLOAT;
-    Lexer_KEYWORDS[251] = Lexer_FLOOR;
-    Lexer_KEYWORDS[252] = Lexer_FOLLOWING;
-    Lexer_KEYWORDS[253] = Lexer_FOR;
-    Lexer_KEYWORDS[254] = Lexer_FORCE;
-    Lexer_KEYWORDS[255] = Lexer_FOREIGN;
-    Lexer_KEYWORDS[256] = Lexer_FORTRAN;
-    Lexer_KEYWORDS[257] = Lexer_FORWARD;
-    Lexer_KEYWORDS[258] = Lexer_FOUND;
-    Lexer_KEYWORDS[259] = Lexer_FRAME_ROW;
-    Lexer_KEYWORDS[260] = Lexer_FREE;
-    Lexer_KEYWORDS[261] = Lexer_FREEZE;
-    Lexer_KEYWORDS[262] = Lexer_FROM;
-    Lexer_KEYWORDS[263] = Lexer_FS;
-    Lexer_KEYWORDS[264] = Lexer_FULL;
-    Lexer_KEYWORDS[265] = Lexer_FUNCTION;
-    Lexer_KEYWORDS[266] = Lexer_FUNCTIONS;
-    Lexer_KEYWORDS[267] = Lexer_FUSION;
-    Lexer_KEYWORDS[268] = Lexer_G;
-    Lexer_KEYWORDS[269] = Lexer_GENERAL;
-    Lexer_KEYWORDS[270] = Lexer_GENERATED;
-    Lexer_KEYWORDS[271] = Lexer_GET;
-    Lexer_KEYWORDS[272] = Lexer_GLOBAL;
-    Lexer_KEYWORDS[273] = Lexer_GO;
-    Lexer_KEYWORDS[274] = Lexer_GOTO;
-    Lexer_KEYWORDS[275] = Lexer_GRANT;
-    Lexer_KEYWORDS[276] = Lexer_GRANTED;
-    Lexer_KEYWORDS[277] = Lexer_GREATEST;
-    Lexer_KEYWORDS[278] = Lexer_GROUP;
-    Lexer_KEYWORDS[279] = Lexer_GROUPING;
-    Lexer_KEYWORDS[280] = Lexer_GROUPS;
-    Lexer_KEYWORDS[281] = Lexer_HANDLER;
-    Lexer_KEYWORDS[282] = Lexer_HAVING;
-    Lexer_KEYWORDS[283] = Lexer_HEADER;
-    Lexer_KEYWORDS[284] = Lexer_HEX;
-    Lexer_KEYWORDS[285] = Lexer_HIERARCHY;
-    Lexer_KEYWORDS[286] = Lexer_HOLD;
-    Lexer_KEYWORDS[287] = Lexer_HOUR;
-    Lexer_KEYWORDS[288] = Lexer_ID;
-    Lexer_KEYWORDS[289] = Lexer_IDENTITY;
-    Lexer_KEYWORDS[290] = Lexer_IF;
-    Lexer_KEYWORDS[291] = Lexer_IGNORE;
-    Lexer_KEYWORDS[292] = Lexer_ILIKE;
-    Lexer_KEYWORDS[293] = Lexer_IMMEDIATE;
-    Lexer_KEYWORDS[294] = Lexer_IMMEDIATELY;
-    Lexer_KEYWORDS[295] = Lexer_IMMUTABLE;
-    Lexer_KEYWORDS[296] = Lexer_IMPLEMENTATION;
-    Lexer_KEYWORDS[297] = Lexer_IMPLICIT;
-    Lexer_KEYWORDS[298] = Lexer_IMPORT;
-    Lexer_KEYWORDS[299] = Lexer_IN;
-    Lexer_KEYWORDS[300] = Lexer_INCLUDE;
-    Lexer_KEYWORDS[301] = Lexer_INCLUDING;
-    Lexer_KEYWORDS[302] = Lexer_INCREMENT;
-    Lexer_KEYWORDS[303] = Lexer_INDENT;
-    Lexer_KEYWORDS[304] = Lexer_INDEX;
-    Lexer_KEYWORDS[305] = Lexer_INDEXES;
-    Lexer_KEYWORDS[306] = Lexer_INDICATOR;
-    Lexer_KEYWORDS[307] = Lexer_INHERIT;
-    Lexer_KEYWORDS[308] = Lexer_INHERITS;
-    Lexer_KEYWORDS[309] = Lexer_INITIALLY;
-    Lexer_KEYWORDS[310] = Lexer_INLINE;
-    Lexer_KEYWORDS[311] = Lexer_INNER;
-    Lexer_KEYWORDS[312] = Lexer_INOUT;
-    Lexer_KEYWORDS[313] = Lexer_INPUT;
-    Lexer_KEYWORDS[314] = Lexer_INSENSITIVE;
-    Lexer_KEYWORDS[315] = Lexer_INSERT;
-    Lexer_KEYWORDS[316] = Lexer_INSTANCE;
-    Lexer_KEYWORDS[317] = Lexer_INSTANTIABLE;
-    Lexer_KEYWORDS[318] = Lexer_INSTEAD;
-    Lexer_KEYWORDS[319] = Lexer_INT;
-    Lexer_KEYWORDS[320] = Lexer_INTEGER;
-    Lexer_KEYWORDS[321] = Lexer_INTEGRITY;
-    Lexer_KEYWORDS[322] = Lexer_INTERSECT;
-    Lexer_KEYWORDS[323] = Lexer_INTERSECTION;
-    Lexer_KEYWORDS[324] = Lexer_INTERVAL;
-    Lexer_KEYWORDS[325] = Lexer_INTO;
-    Lexer_KEYWORDS[326] = Lexer_INVOKER;
-    Lexer_KEYWORDS[327] = Lexer_IS;
-    Lexer_KEYWORDS[328] = Lexer_ISNULL;
-    Lexer_KEYWORDS[329] = Lexer_ISOLATION;
-    Lexer_KEYWORDS[330] = Lexer_JOIN;
-    Lexer_KEYWORDS[331] = Lexer_K;
-    Lexer_KEYWORDS[332] = Lexer_KEY;
-    Lexer_KEYWORDS[333] = Lexer_KEY_MEMBER;
-    Lexer_KEYWORDS[334] = Lexer_KEY_TYPE;
-    Lexer_KEYWORDS[335] = Lexer_LABEL;
-    Lexer_KEYWORDS[336] = Lexer_LAG;
-    Lexer_KEYWORDS[337] = Lexer_LANGUAGE;
-    Lexer_KEYWORDS[338] = Lexer_LARGE;
-    Lexer_KEYWORDS[339] = Lexer_LAST;
-    Lexer_KEYWORDS[340] = Lexer_LAST_VALUE;
-    Lexer_KEYWORDS[341] = Lexer_LATERAL;
-    Lexer_KEYWORDS[342] = Lexer_LEAD;
-    Lexer_KEYWORDS[343] = Lexer_LEADING;
-    Lexer_KEYWORDS[344] = Lexer_LEAKPROOF;
-    Lexer_KEYWORDS[345] = Lexer_LEAST;
-    Lexer_KEYWORDS[346] = Lexer_LEFT;
-    Lexer_KEYWORDS[347] = Lexer_LENGTH;
-    Lexer_KEYWORDS[348] = Lexer_LEVEL;
-    Lexer_KEYWORDS[349] = Lexer_LIBRARY;
-    Lexer_KEYWORDS[350] = Lexer_LIKE;
-    Lexer_KEYWORDS[351] = Lexer_LIKE_REGEX;
-    Lexer_KEYWORDS[352] = Lexer_LIMIT;
-    Lexer_KEYWORDS[353] = Lexer_LINK;
-    Lexer_KEYWORDS[354] = Lexer_LISTEN;
-    Lexer_KEYWORDS[355] = Lexer_LN;
-    Lexer_KEYWORDS[356] = Lexer_LOAD;
-    Lexer_KEYWORDS[357] = Lexer_LOCAL;
-    Lexer_KEYWORDS[358] = Lexer_LOCALTIME;
-    Lexer_KEYWORDS[359] = Lexer_LOCALTIMESTAMP;
-    Lexer_KEYWORDS[360] = Lexer_LOCATION;
-    Lexer_KEYWORDS[361] = Lexer_LOCATOR;
-    Lexer_KEYWORDS[362] = Lexer_LOCK;
-    Lexer_KEYWORDS[363] = Lexer_LOCKED;
-    Lexer_KEYWORDS[364] = Lexer_LOGGED;
-    Lexer_KEYWORDS[365] = Lexer_LOWER;
-    Lexer_KEYWORDS[366] = Lexer_M;
-    Lexer_KEYWORDS[367] = Lexer_MAP;
-    Lexer_KEYWORDS[368] = Lexer_MAPPING;
-    Lexer_KEYWORDS[369] = Lexer_MATCH;
-    Lexer_KEYWORDS[370] = Lexer_MATCHED;
-    Lexer_KEYWORDS[371] = Lexer_MATERIALIZED;
-    Lexer_KEYWORDS[372] = Lexer_MAX;
-    Lexer_KEYWORDS[373] = Lexer_MAXVALUE;
-    Lexer_KEYWORDS[374] = Lexer_MAX_CARDINALITY;
-    Lexer_KEYWORDS[375] = Lexer_MEMBER;
-    Lexer_KEYWORDS[376] = Lexer_MERGE;
-    Lexer_KEYWORDS[377] = Lexer_MESSAGE_LENGTH;
-    Lexer_KEYWORDS[378] = Lexer_MESSAGE_OCTET_LENGTH;
-    Lexer_KEYWORDS[379] = Lexer_MESSAGE_TEXT;
-    Lexer_KEYWORDS[380] = Lexer_METHOD;
-    Lexer_KEYWORDS[381] = Lexer_MIN;
-    Lexer_KEYWORDS[382] = Lexer_MINUTE;
-    Lexer_KEYWORDS[383] = Lexer_MINVALUE;
-    Lexer_KEYWORDS[384] = Lexer_MOD;
-    Lexer_KEYWORDS[385] = Lexer_MODE;
-    Lexer_KEYWORDS[386] = Lexer_MODIFIES;
-    Lexer_KEYWORDS[387] = Lexer_MODULE;
-    Lexer_KEYWORDS[388] = Lexer_MONTH;
-    Lexer_KEYWORDS[389] = Lexer_MORE;
-    Lexer_KEYWORDS[390] = Lexer_MOVE;
-    Lexer_KEYWORDS[391] = Lexer_MULTISET;
-    Lexer_KEYWORDS[392] = Lexer_MUMPS;
-    Lexer_KEYWORDS[393] = Lexer_NAME;
-    Lexer_KEYWORDS[394] = Lexer_NAMES;
-    Lexer_KEYWORDS[395] = Lexer_NAMESPACE;
-    Lexer_KEYWORDS[396] = Lexer_NATIONAL;
-    Lexer_KEYWORDS[397] = Lexer_NATURAL;
-    Lexer_KEYWORDS[398] = Lexer_NCHAR;
-    Lexer_KEYWORDS[399] = Lexer_NCLOB;
-    Lexer_KEYWORDS[400] = Lexer_NESTING;
-    Lexer_KEYWORDS[401] = Lexer_NEW;
-    Lexer_KEYWORDS[402] = Lexer_NEXT;
-    Lexer_KEYWORDS[403] = Lexer_NFC;
-    Lexer_KEYWORDS[404] = Lexer_NFD;
-    Lexer_KEYWORDS[405] = Lexer_NFKC;
-    Lexer_KEYWORDS[406] = Lexer_NFKD;
-    Lexer_KEYWORDS[407] = Lexer_NIL;
-    Lexer_KEYWORDS[408] = Lexer_NO;
-    Lexer_KEYWORDS[409] = Lexer_NONE;
-    Lexer_KEYWORDS[410] = Lexer_NORMALIZE;
-    Lexer_KEYWORDS[411] = Lexer_NORMALIZED;
-    Lexer_KEYWORDS[412] = Lexer_NOT;
-    Lexer_KEYWORDS[413] = Lexer_NOTHING;
-    Lexer_KEYWORDS[414] = Lexer_NOTIFY;
-    Lexer_KEYWORDS[415] = Lexer_NOTNULL;
-    Lexer_KEYWORDS[416] = Lexer_NOWAIT;
-    Lexer_KEYWORDS[417] = Lexer_NTH_VALUE;
-    Lexer_KEYWORDS[418] = Lexer_NTILE;
-    Lexer_KEYWORDS[419] = Lexer_NULL;
-    Lexer_KEYWORDS[420] = Lexer_NULLABLE;
-    Lexer_KEYWORDS[421] = Lexer_NULLIF;
-    Lexer_KEYWORDS[422] = Lexer_NULLS;
-    Lexer_KEYWORDS[423] = Lexer_NUMBER;
-    Lexer_KEYWORDS[424] = Lexer_NUMERIC;
-    Lexer_KEYWORDS[425] = Lexer_OBJECT;
-    Lexer_KEYWORDS[426] = Lexer_OCCURRENCES_REGEX;
-    Lexer_KEYWORDS[427] = Lexer_OCTETS;
-    Lexer_KEYWORDS[428] = Lexer_OCTET_LENGTH;
-    Lexer_KEYWORDS[429] = Lexer_OF;
-    Lexer_KEYWORDS[430] = Lexer_OFF;
-    Lexer_KEYWORDS[431] = Lexer_OFFSET;
-    Lexer_KEYWORDS[432] = Lexer_OIDS;
-    Lexer_KEYWORDS[433] = Lexer_OLD;
-    Lexer_KEYWORDS[434] = Lexer_ON;
-    Lexer_KEYWORDS[435] = Lexer_ONLY;
-    Lexer_KEYWORDS[436] = Lexer_OPEN;
-    Lexer_KEYWORDS[437] = Lexer_OPERATOR;
-    Lexer_KEYWORDS[438] = Lexer_OPTION;
-    Lexer_KEYWORDS[439] = Lexer_OPTIONS;
-    Lexer_KEYWORDS[440] = Lexer_OR;
-    Lexer_KEYWORDS[441] = Lexer_ORDER;
-    Lexer_KEYWORDS[442] = Lexer_ORDERING;
-    Lexer_KEYWORDS[443] = Lexer_ORDINALITY;
-    Lexer_KEYWORDS[444] = Lexer_OTHERS;
-    Lexer_KEYWORDS[445] = Lexer_OUT;
-    Lexer_KEYWORDS[446] = Lexer_OUTER;
-    Lexer_KEYWORDS[447] = Lexer_OUTPUT;
-    Lexer_KEYWORDS[448] = Lexer_OVER;
-    Lexer_KEYWORDS[449] = Lexer_OVERLAPS;
-    Lexer_KEYWORDS[450] = Lexer_OVERLAY;
-    Lexer_KEYWORDS[451] = Lexer_OVERRIDING;
-    Lexer_KEYWORDS[452] = Lexer_OWNED;
-    Lexer_KEYWORDS[453] = Lexer_OWNER;
-    Lexer_KEYWORDS[454] = Lexer_P;
-    Lexer_KEYWORDS[455] = Lexer_PAD;
-    Lexer_KEYWORDS[456] = Lexer_PARALLEL;
-    Lexer_KEYWORDS[457] = Lexer_PARAMETER;
-    Lexer_KEYWORDS[458] = Lexer_PARAMETER_MODE;
-    Lexer_KEYWORDS[459] = Lexer_PARAMETER_NAME;
-    Lexer_KEYWORDS[460] = Lexer_PARAMETER_ORDINAL_POSITION;
-    Lexer_KEYWORDS[461] = Lexer_PARAMETER_SPECIFIC_CATALOG;
-    Lexer_KEYWORDS[462] = Lexer_PARAMETER_SPECIFIC_NAME;
-    Lexer_KEYWORDS[463] = Lexer_PARAMETER_SPECIFIC_SCHEMA;
-    Lexer_KEYWORDS[464] = Lexer_PARSER;
-    Lexer_KEYWORDS[465] = Lexer_PARTIAL;
-    Lexer_KEYWORDS[466] = Lexer_PARTITION;
-    Lexer_KEYWORDS[467] = Lexer_PASCAL;
-    Lexer_KEYWORDS[468] = Lexer_PASSING;
-    Lexer_KEYWORDS[469] = Lexer_PASSTHROUGH;
-    Lexer_KEYWORDS[470] = Lexer_PASSWORD;
-    Lexer_KEYWORDS[471] = Lexer_PATH;
-    Lexer_KEYWORDS[472] = Lexer_PERCENT;
-    Lexer_KEYWORDS[473] = Lexer_PERCENTILE_CONT;
-    Lexer_KEYWORDS[474] = Lexer_PERCENTILE_DISC;
-    Lexer_KEYWORDS[475] = Lexer_PERCENT_RANK;
-    Lexer_KEYWORDS[476] = Lexer_PERIOD;
-    Lexer_KEYWORDS[477] = Lexer_PERMISSION;
-    Lexer_KEYWORDS[478] = Lexer_PLACING;
-    Lexer_KEYWORDS[479] = Lexer_PLANS;
-    Lexer_KEYWORDS[480] = Lexer_PLI;
-    Lexer_KEYWORDS[481] = Lexer_POLICY;
-    Lexer_KEYWORDS[482] = Lexer_PORTION;
-    Lexer_KEYWORDS[483] = Lexer_POSITION;
-    Lexer_KEYWORDS[484] = Lexer_POSITION_REGEX;
-    Lexer_KEYWORDS[485] = Lexer_POWER;
-    Lexer_KEYWORDS[486] = Lexer_PRECEDES;
-    Lexer_KEYWORDS[487] = Lexer_PRECEDING;
-    Lexer_KEYWORDS[488] = Lexer_PRECISION;
-    Lexer_KEYWORDS[489] = Lexer_PREPARE;
-    Lexer_KEYWORDS[490] = Lexer_PREPARED;
-    Lexer_KEYWORDS[491] = Lexer_PRESERVE;
-    Lexer_KEYWORDS[492] = Lexer_PRIMARY;
-    Lexer_KEYWORDS[493] = Lexer_PRIOR;
-    Lexer_KEYWORDS[494] = Lexer_PRIVILEGES;
-    Lexer_KEYWORDS[495] = Lexer_PROCEDURAL;
-    Lexer_KEYWORDS[496] = Lexer_PROCEDURE;
-    Lexer_KEYWORDS[497] = Lexer_PROCEDURES;
-    Lexer_KEYWORDS[498] = Lexer_PROGRAM;
-    Lexer_KEYWORDS[499] = Lexer_PUBLIC;
-    Lexer_KEYWORDS[500] = Lexer_PUBLICATION;
-    Lexer_KEYWORDS[501] = Lexer_QUOTE;
-    Lexer_KEYWORDS[502] = Lexer_RANGE;
-    Lexer_KEYWORDS[503] = Lexer_RANK;
-    Lexer_KEYWORDS[504] = Lexer_READ;
-    Lexer_KEYWORDS[505] = Lexer_READS;
-    Lexer_KEYWORDS[506] = Lexer_REAL;
-    Lexer_KEYWORDS[507] = Lexer_REASSIGN;
-    Lexer_KEYWORDS[508] = Lexer_RECHECK;
-    Lexer_KEYWORDS[509] = Lexer_RECOVERY;
-    Lexer_KEYWORDS[510] = Lexer_RECURSIVE;
-    Lexer_KEYWORDS[511] = Lexer_REF;
-    Lexer_KEYWORDS[512] = Lexer_REFERENCES;
-    Lexer_KEYWORDS[513] = Lexer_REFERENCING;
-    Lexer_KEYWORDS[514] = Lexer_REFRESH;
-    Lexer_KEYWORDS[515] = Lexer_REGR_AVGX;
-    Lexer_KEYWORDS[516] = Lexer_REGR_AVGY;
-    Lexer_KEYWORDS[517] = Lexer_REGR_COUNT;
-    Lexer_KEYWORDS[518] = Lexer_REGR_INTERCEPT;
-    Lexer_KEYWORDS[519] = Lexer_REGR_R2;
-    Lexer_KEYWORDS[520] = Lexer_REGR_SLOPE;
-    Lexer_KEYWORDS[521] = Lexer_REGR_SXX;
-    Lexer_KEYWORDS[522] = Lexer_REGR_SXY;
-    Lexer_KEYWORDS[523] = Lexer_REGR_SYY;
-    Lexer_KEYWORDS[524] = Lexer_REINDEX;
-    Lexer_KEYWORDS[525] = Lexer_RELATIVE;
-    Lexer_KEYWORDS[526] = Lexer_RELEASE;
-    Lexer_KEYWORDS[527] = Lexer_RENAME;
-    Lexer_KEYWORDS[528] = Lexer_REPEATABLE;
-    Lexer_KEYWORDS[529] = Lexer_REPLACE;
-    Lexer_KEYWORDS[530] = Lexer_REPLICA;
-    Lexer_KEYWORDS[531] = Lexer_REQUIRING;
-    Lexer_KEYWORDS[532] = Lexer_RESET;
-    Lexer_KEYWORDS[533] = Lexer_RESPECT;
-    Lexer_KEYWORDS[534] = Lexer_RESTART;
-    Lexer_KEYWORDS[535] = Lexer_RESTORE;
-    Lexer_KEYWORDS[536] = Lexer_RESTRICT;
-    Lexer_KEYWORDS[537] = Lexer_RESULT;
-    Lexer_KEYWORDS[538] = Lexer_RETURN;
-    Lexer_KEYWORDS[539] = Lexer_RETURNED_CARDINALITY;
-    Lexer_KEYWORDS[540] = Lexer_RETURNED_LENGTH;
-    Lexer_KEYWORDS[541] = Lexer_RETURNED_OCTET_LENGTH;
-    Lexer_KEYWORDS[542] = Lexer_RETURNED_SQLSTATE;
-    Lexer_KEYWORDS[543] = Lexer_RETURNING;
-    Lexer_KEYWORDS[544] = Lexer_RETURNS;
-    Lexer_KEYWORDS[545] = Lexer_REVOKE;
-    Lexer_KEYWORDS[546] = Lexer_RIGHT;
-    Lexer_KEYWORDS[547] = Lexer_ROLE;
-    Lexer_KEYWORDS[548] = Lexer_ROLLBACK;
-    Lexer_KEYWORDS[549] = Lexer_ROLLUP;
-    Lexer_KEYWORDS[550] = Lexer_ROUTINE;
-    Lexer_KEYWORDS[551] = Lexer_ROUTINES;
-    Lexer_KEYWORDS[552] = Lexer_ROUTINE_CATALOG;
-    Lexer_KEYWORDS[553] = Lexer_ROUTINE_NAME;
-    Lexer_KEYWORDS[554] = Lexer_ROUTINE_SCHEMA;
-    Lexer_KEYWORDS[555] = Lexer_ROW;
-    Lexer_KEYWORDS[556] = Lexer_ROWS;
-    Lexer_KEYWORDS[557] = Lexer_ROW_COUNT;
-    Lexer_KEYWORDS[558] = Lexer_ROW_NUMBER;
-    Lexer_KEYWORDS[559] = Lexer_RULE;
-    Lexer_KEYWORDS[560] = Lexer_SAVEPOINT;
-    Lexer_KEYWORDS[561] = Lexer_SCALE;
-    Lexer_KEYWORDS[562] = Lexer_SCHEMA;
-    Lexer_KEYWORDS[563] = Lexer_SCHEMAS;
-    Lexer_KEYWORDS[564] = Lexer_SCHEMA_NAME;
-    Lexer_KEYWORDS[565] = Lexer_SCOPE;
-    Lexer_KEYWORDS[566] = Lexer_SCOPE_CATALOG;
-    Lexer_KEYWORDS[567] = Lexer_SCOPE_NAME;
-    Lexer_KEYWORDS[568] = Lexer_SCOPE_SCHEMA;
-    Lexer_KEYWORDS[569] = Lexer_SCROLL;
-    Lexer_KEYWORDS[570] = Lexer_SEARCH;
-    Lexer_KEYWORDS[571] = Lexer_SECOND;
-    Lexer_KEYWORDS[572] = Lexer_SECTION;
-    Lexer_KEYWORDS[573] = Lexer_SECURITY;
-    Lexer_KEYWORDS[574] = Lexer_SELECT;
-    Lexer_KEYWORDS[575] = Lexer_SELECTIVE;
-    Lexer_KEYWORDS[576] = Lexer_SELF;
-    Lexer_KEYWORDS[577] = Lexer_SENSITIVE;
-    Lexer_KEYWORDS[578] = Lexer_SEQUENCE;
-    Lexer_KEYWORDS[579] = Lexer_SEQUENCES;
-    Lexer_KEYWORDS[580] = Lexer_SERIALIZABLE;
-    Lexer_KEYWORDS[581] = Lexer_SERVER;
-    Lexer_KEYWORDS[582] = Lexer_SERVER_NAME;
-    Lexer_KEYWORDS[583] = Lexer_SESSION;
-    Lexer_KEYWORDS[584] = Lexer_SESSION_USER;
-    Lexer_KEYWORDS[585] = Lexer_SET;
-    Lexer_KEYWORDS[586] = Lexer_SETOF;
-    Lexer_KEYWORDS[587] = Lexer_SETS;
-    Lexer_KEYWORDS[588] = Lexer_SHARE;
-    Lexer_KEYWORDS[589] = Lexer_SHOW;
-    Lexer_KEYWORDS[590] = Lexer_SIMILAR;
-    Lexer_KEYWORDS[591] = Lexer_SIMPLE;
-    Lexer_KEYWORDS[592] = Lexer_SIZE;
-    Lexer_KEYWORDS[593] = Lexer_SKIP;
-    Lexer_KEYWORDS[594] = Lexer_SMALLINT;
-    Lexer_KEYWORDS[595] = Lexer_SNAPSHOT;
-    Lexer_KEYWORDS[596] = Lexer_SOME;
-    Lexer_KEYWORDS[597] = Lexer_SOURCE;
-    Lexer_KEYWORDS[598] = Lexer_SPACE;
-    Lexer_KEYWORDS[599] = Lexer_SPECIFIC;
-    Lexer_KEYWORDS[600] = Lexer_SPECIFICTYPE;
-    Lexer_KEYWORDS[601] = Lexer_SPECIFIC_NAME;
-    Lexer_KEYWORDS[602] = Lexer_SQL;
-    Lexer_KEYWORDS[603] = Lexer_SQLCODE;
-    Lexer_KEYWORDS[604] = Lexer_SQLERROR;
-    Lexer_KEYWORDS[605] = Lexer_SQLEXCEPTION;
-    Lexer_KEYWORDS[606] = Lexer_SQLSTATE;
-    Lexer_KEYWORDS[607] = Lexer_SQLWARNING;
-    Lexer_KEYWORDS[608] = Lexer_SQRT;
-    Lexer_KEYWORDS[609] = Lexer_STABLE;
-    Lexer_KEYWORDS[610] = Lexer_STANDALONE;
-    Lexer_KEYWORDS[611] = Lexer_START;
-    Lexer_KEYWORDS[612] = Lexer_STATE;
-    Lexer_KEYWORDS[613] = Lexer_STATEMENT;
-    Lexer_KEYWORDS[614] = Lexer_STATIC;
-    Lexer_KEYWORDS[615] = Lexer_STATISTICS;
-    Lexer_KEYWORDS[616] = Lexer_STDDEV_POP;
-    Lexer_KEYWORDS[617] = Lexer_STDDEV_SAMP;
-    Lexer_KEYWORDS[618] = Lexer_STDIN;
-    Lexer_KEYWORDS[619] = Lexer_STDOUT;
-    Lexer_KEYWORDS[620] = Lexer_STORAGE;
-    Lexer_KEYWORDS[621] = Lexer_STRICT;
-    Lexer_KEYWORDS[622] = Lexer_STRIP;
-    Lexer_KEYWORDS[623] = Lexer_STRUCTURE;
-    Lexer_KEYWORDS[624] = Lexer_STYLE;
-    Lexer_KEYWORDS[625] = Lexer_SUBCLASS_ORIGIN;
-    Lexer_KEYWORDS[626] = Lexer_SUBMULTISET;
-    Lexer_KEYWORDS[627] = Lexer_SUBSCRIPTION;
-    Lexer_KEYWORDS[628] = Lexer_SUBSTRING;
-    Lexer_KEYWORDS[629] = Lexer_SUBSTRING_REGEX;
-    Lexer_KEYWORDS[630] = Lexer_SUCCEEDS;
-    Lexer_KEYWORDS[631] = Lexer_SUM;
-    Lexer_KEYWORDS[632] = Lexer_SYMMETRIC;
-    Lexer_KEYWORDS[633] = Lexer_SYSID;
-    Lexer_KEYWORDS[634] = Lexer_SYSTEM;
-    Lexer_KEYWORDS[635] = Lexer_SYSTEM_TIME;
-    Lexer_KEYWORDS[636] = Lexer_SYSTEM_USER;
-    Lexer_KEYWORDS[637] = Lexer_T;
-    Lexer_KEYWORDS[638] = Lexer_TABLE;
-    Lexer_KEYWORDS[639] = Lexer_TABLES;
-    Lexer_KEYWORDS[640] = Lexer_TABLESAMPLE;
-    Lexer_KEYWORDS[641] = Lexer_TABLESPACE;
-    Lexer_KEYWORDS[642] = Lexer_TABLE_NAME;
-    Lexer_KEYWORDS[643] = Lexer_TEMP;
-    Lexer_KEYWORDS[644] = Lexer_TEMPLATE;
-    Lexer_KEYWORDS[645] = Lexer_TEMPORARY;
-    Lexer_KEYWORDS[646] = Lexer_TEXT;
-    Lexer_KEYWORDS[647] = Lexer_THEN;
-    Lexer_KEYWORDS[648] = Lexer_TIES;
-    Lexer_KEYWORDS[649] = Lexer_TIME;
-    Lexer_KEYWORDS[650] = Lexer_TIMESTAMP;
-    Lexer_KEYWORDS[651] = Lexer_TIMEZONE_HOUR;
-    Lexer_KEYWORDS[652] = Lexer_TIMEZONE_MINUTE;
-    Lexer_KEYWORDS[653] = Lexer_TO;
-    Lexer_KEYWORDS[654] = Lexer_TOKEN;
-    Lexer_KEYWORDS[655] = Lexer_TOP_LEVEL_COUNT;
-    Lexer_KEYWORDS[656] = Lexer_TRAILING;
-    Lexer_KEYWORDS[657] = Lexer_TRANSACTION;
-    Lexer_KEYWORDS[658] = Lexer_TRANSACTIONS_COMMITTED;
-    Lexer_KEYWORDS[659] = Lexer_TRANSACTIONS_ROLLED_BACK;
-    Lexer_KEYWORDS[660] = Lexer_TRANSACTION_ACTIVE;
-    Lexer_KEYWORDS[661] = Lexer_TRANSFORM;
-    Lexer_KEYWORDS[662] = Lexer_TRANSFORMS;
-    Lexer_KEYWORDS[663] = Lexer_TRANSLATE;
-    Lexer_KEYWORDS[664] = Lexer_TRANSLATE_REGEX;
-    Lexer_KEYWORDS[665] = Lexer_TRANSLATION;
-    Lexer_KEYWORDS[666] = Lexer_TREAT;
-    Lexer_KEYWORDS[667] = Lexer_TRIGGER;
-    Lexer_KEYWORDS[668] = Lexer_TRIGGER_CATALOG;
-    Lexer_KEYWORDS[669] = Lexer_TRIGGER_NAME;
-    Lexer_KEYWORDS[670] = Lexer_TRIGGER_SCHEMA;
-    Lexer_KEYWORDS[671] = Lexer_TRIM;
-    Lexer_KEYWORDS[672] = Lexer_TRIM_ARRAY;
-    Lexer_KEYWORDS[673] = Lexer_TRUE;
-    Lexer_KEYWORDS[674] = Lexer_TRUNCATE;
-    Lexer_KEYWORDS[675] = Lexer_TRUSTED;
-    Lexer_KEYWORDS[676] = Lexer_TYPE;
-    Lexer_KEYWORDS[677] = Lexer_TYPES;
-    Lexer_KEYWORDS[678] = Lexer_UESCAPE;
-    Lexer_KEYWORDS[679] = Lexer_UNBOUNDED;
-    Lexer_KEYWORDS[680] = Lexer_UNCOMMITTED;
-    Lexer_KEYWORDS[681] = Lexer_UNDER;
-    Lexer_KEYWORDS[682] = Lexer_UNENCRYPTED;
-    Lexer_KEYWORDS[683] = Lexer_UNION;
-    Lexer_KEYWORDS[684] = Lexer_UNIQUE;
-    Lexer_KEYWORDS[685] = Lexer_UNKNOWN;
-    Lexer_KEYWORDS[686] = Lexer_UNLINK;
-    Lexer_KEYWORDS[687] = Lexer_UNLISTEN;
-    Lexer_KEYWORDS[688] = Lexer_UNLOGGED;
-    Lexer_KEYWORDS[689] = Lexer_UNNAMED;
-    Lexer_KEYWORDS[690] = Lexer_UNNEST;
-    Lexer_KEYWORDS[691] = Lexer_UNTIL;
-    Lexer_KEYWORDS[692] = Lexer_UNTYPED;
-    Lexer_KEYWORDS[693] = Lexer_UPDATE;
-    Lexer_KEYWORDS[694] = Lexer_UPPER;
-    Lexer_KEYWORDS[695] = Lexer_URI;
-    Lexer_KEYWORDS[696] = Lexer_USAGE;
-    Lexer_KEYWORDS[697] = Lexer_USER;
-    Lexer_KEYWORDS[698] = Lexer_USER_DEFINED_TYPE_CATALOG;
-    Lexer_KEYWORDS[699] = Lexer_USER_DEFINED_TYPE_CODE;
-    Lexer_KEYWORDS[700] = Lexer_USER_DEFINED_TYPE_NAME;
-    Lexer_KEYWORDS[701] = Lexer_USER_DEFINED_TYPE_SCHEMA;
-    Lexer_KEYWORDS[702] = Lexer_USING;
-    Lexer_KEYWORDS[703] = Lexer_VACUUM;
-    Lexer_KEYWORDS[704] = Lexer_VALID;
-    Lexer_KEYWORDS[705] = Lexer_VALIDATE;
-    Lexer_KEYWORDS[706] = Lexer_VALIDATOR;
-    Lexer_KEYWORDS[707] = Lexer_VALUE;
-    Lexer_KEYWORDS[708] = Lexer_VALUES;
-    Lexer_KEYWORDS[709] = Lexer_VALUE_OF;
-    Lexer_KEYWORDS[710] = Lexer_VARBINARY;
-    Lexer_KEYWORDS[711] = Lexer_VARCHAR;
-    Lexer_KEYWORDS[712] = Lexer_VARIADIC;
-    Lexer_KEYWORDS[713] = Lexer_VARYING;
-    Lexer_KEYWORDS[714] = Lexer_VAR_POP;
-    Lexer_KEYWORDS[715] = Lexer_VAR_SAMP;
-    Lexer_KEYWORDS[716] = Lexer_VERBOSE;
-    Lexer_KEYWORDS[717] = Lexer_VERSION;
-    Lexer_KEYWORDS[718] = Lexer_VERSIONING;
-    Lexer_KEYWORDS[719] = Lexer_VIEW;
-    Lexer_KEYWORDS[720] = Lexer_VIEWS;
-    Lexer_KEYWORDS[721] = Lexer_VOLATILE;
-    Lexer_KEYWORDS[722] = Lexer_WHEN;
-    Lexer_KEYWORDS[723] = Lexer_WHENEVER;
-    Lexer_KEYWORDS[724] = Lexer_WHERE;
-    Lexer_KEYWORDS[725] = Lexer_WHITESPACE;
-    Lexer_KEYWORDS[726] = Lexer_WIDTH_BUCKET;
-    Lexer_KEYWORDS[727] = Lexer_WINDOW;
-    Lexer_KEYWORDS[728] = Lexer_WITH;
-    Lexer_KEYWORDS[729] = Lexer_WITHIN;
-    Lexer_KEYWORDS[730] = Lexer_WITHOUT;
-    Lexer_KEYWORDS[731] = Lexer_WORK;
-    Lexer_KEYWORDS[732] = Lexer_WRAPPER;
-    Lexer_KEYWORDS[733] = Lexer_WRITE;
-    Lexer_KEYWORDS[734] = Lexer_XML;
-    Lexer_KEYWORDS[735] = Lexer_XMLAGG;
-    Lexer_KEYWORDS[736] = Lexer_XMLATTRIBUTES;
-    Lexer_KEYWORDS[737] = Lexer_XMLBINARY;
-    Lexer_KEYWORDS[738] = Lexer_XMLCAST;
-    Lexer_KEYWORDS[739] = Lexer_XMLCOMMENT;
-    Lexer_KEYWORDS[740] = Lexer_XMLCONCAT;
-    Lexer_KEYWORDS[741] = Lexer_XMLDECLARATION;
-    Lexer_KEYWORDS[742] = Lexer_XMLDOCUMENT;
-    Lexer_KEYWORDS[743] = Lexer_XMLELEMENT;
-    Lexer_KEYWORDS[744] = Lexer_XMLEXISTS;
-    Lexer_KEYWORDS[745] = Lexer_XMLFOREST;
-    Lexer_KEYWORDS[746] = Lexer_XMLITERATE;
-    Lexer_KEYWORDS[747] = Lexer_XMLNAMESPACES;
-    Lexer_KEYWORDS[748] = Lexer_XMLPARSE;
-    Lexer_KEYWORDS[749] = Lexer_XMLPI;
-    Lexer_KEYWORDS[750] = Lexer_XMLQUERY;
-    Lexer_KEYWORDS[751] = Lexer_XMLROOT;
-    Lexer_KEYWORDS[752] = Lexer_XMLSCHEMA;
-    Lexer_KEYWORDS[753] = Lexer_XMLSERIALIZE;
-    Lexer_KEYWORDS[754] = Lexer_XMLTABLE;
-    Lexer_KEYWORDS[755] = Lexer_XMLTEXT;
-    Lexer_KEYWORDS[756] = Lexer_XMLVALIDATE;
-    Lexer_KEYWORDS[757] = Lexer_YEAR;
-    Lexer_KEYWORDS[758] = Lexer_YES;
-    Lexer_KEYWORDS[759] = Lexer_ZONE;
+/**
+ * Lexeme is upper-cased as ASCII and searched among the keywords of its
+ * length only, anything non-ASCII can't be a keyword.
+ */
+static int is_keyword(Lexer *tokenizer) {
+    size_t len = tokenizer->lexemeEnd - tokenizer->lexemeStart;
+    if (len == 0 || len > LEXER_KEYWORD_MAX)
+        return 0;
+    const unsigned char *data = (const unsigned char *) tokenizer->data + tokenizer->lexemeStart;
+    char folded[LEXER_KEYWORD_MAX];
+    for (size_t i = 0; i < len; i++) {
+        if (data[i] >= 0x80)
+            return 0;
+        folded[i] = (char) (data[i] >= 'a' && data[i] <= 'z' ? data[i] - 'a' + 'A' : data[i]);
+    }
+    size_t low = Lexer_KEYWORD_BUCKETS[len];
+    size_t high = Lexer_KEYWORD_BUCKETS[len + 1];
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        int cmp = memcmp(folded, Lexer_KEYWORDS[mid], len);
+        if (cmp == 0)
+            return 1;
+        if (cmp < 0)
+            high = mid;
+        else
+            low = mid + 1;
+    }
+    return 0;
 }
@@ -2,17 +2,39 @@
 #include <stdio.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <unistd.h>
 
 #include <types.h>
 #include <simple.h>
+#include <directory.h>
+#include <output.h>
+#include <pool.h>
+#include <report.h>
+#include <slice.h>
 #include <lexer.h>
 #include <parser.h>
 
 static const char *HELP_MSG = ""
                               "fixpq - remove invalid for PostgreSQL 9.6 parts in sql dumb\n"
                               "  -h | --help       show this message\n"
-                              "  -o | --out=file   write to target file\n"
-                              "  -f | --file=file  read from file\n";
+                              "  -o | --out=file   write to target file, `-` for stdout\n"
+                              "  -f | --file=file  read from file, `-` for stdin\n"
+                              "  --dry             write nothing, print JSON report of what would be changed\n"
+                              "  --compress=codec  compress output with `gzip` or `zstd`,\n"
+                              "                    default is picked from .gz or .zst output extension\n"
+                              "  -j | --jobs=n     number of threads scanning and compressing, all cores by default\n"
+                              "  --link            hardlink data files of directory dump instead of copying\n"
+                              "  --resume          continue conversion from checkpoint in <out>.journal\n"
+                              "  --compact         fix plain file in place within itself instead of writing\n"
+                              "                    a copy, slower as every block is synced with <file>.journal\n"
+                              "  --stats           print how often stages of streamed input waited for each other\n"
+                              "  --range=start:len convert only lines starting within given bytes of input,\n"
+                              "                    slice is described by <out>.manifest\n"
+                              "  merge -o file part...\n"
+                              "                    join outputs of --range slices into whole conversion\n"
+                              "\n"
+                              "Without -f data piped to stdin is streamed to stdout.\n"
+                              "Directory given to -f is read as pg_dump -Fd dump, -o names output directory.\n";
 static const char *SHORT_HELP_FLAG = "-h";
 static const char *LONG_HELP_FLAG = "--help";
 static const char *SHORT_INPUT_FLAG = "-f";
@@ -20,6 +42,15 @@ static const char *LONG_INPUT_FLAG = "--file";
 static const char *SHORT_OUTPUT_FLAG = "-o";
 static const char *LONG_OUTPUT_FLAG = "--out";
 static const char *LONG_DRY_FLAG = "--dry";
+static const char *LONG_COMPRESS_FLAG = "--compress";
+static const char *SHORT_JOBS_FLAG = "-j";
+static const char *LONG_JOBS_FLAG = "--jobs";
+static const char *LONG_LINK_FLAG = "--link";
+static const char *LONG_RESUME_FLAG = "--resume";
+static const char *LONG_RANGE_FLAG = "--range";
+static const char *LONG_STATS_FLAG = "--stats";
+static const char *LONG_COMPACT_FLAG = "--compact";
+static const char *MERGE_COMMAND = "merge";
 
 void print_help(int status) {
     printf("%s\n", HELP_MSG);
@@ -34,17 +65,70 @@ void copy_to(char **dest, char *src) {
     strcpy(*dest, src);
 }
 
+short is_stdin(State *state) {
+    return strcmp(state->input, "-") == 0;
+}
+
 void open_in(State *state) {
     if (!state->input) {
         return;
     }
+    if (is_stdin(state)) {
+        state->in = stdin;
+        return;
+    }
     state->in = fopen(state->input, "r");
     if (state->in == NULL) {
-        printf("File not found: %s\n", state->input);
+        fprintf(stderr, "File not found: %s\n", state->input);
+        exit(1);
+    }
+}
+
+
+void parse_range(State *state, const char *value) {
+    const char *from = value;
+    char *end;
+    unsigned long long start = strtoull(from, &end, 10);
+    unsigned long long len = 0;
+    if (end != from && *end == ':') {
+        from = end + 1;
+        len = strtoull(from, &end, 10);
+    }
+    if (end == from || *end != '\0' || len == 0) {
+        fprintf(stderr, "Invalid range, expected start:len: %s\n", value);
         exit(1);
     }
+    state->ranged = 1;
+    state->rangeStart = (size_t) start;
+    state->rangeLen = (size_t) len;
 }
 
+short ends_with(const char *value, const char *suffix) {
+    size_t len = strlen(value);
+    size_t suffix_len = strlen(suffix);
+    return len >= suffix_len && strcmp(value + len - suffix_len, suffix) == 0;
+}
+
+void parse_compress(State *state, const char *value) {
+    if (strcmp(value, "gzip") == 0) {
+        state->compress = OutputFormat_Gzip;
+    } else if (strcmp(value, "zstd") == 0) {
+        state->compress = OutputFormat_Zstd;
+    } else {
+        fprintf(stderr, "Unknown compression: %s\n", value);
+        exit(1);
+    }
+}
+
+void parse_jobs(State *state, const char *value) {
+    char *end;
+    long jobs = strtol(value, &end, 10);
+    if (end == value || *end != '\0' || jobs < 1) {
+        fprintf(stderr, "Invalid number of jobs: %s\n", value);
+        exit(1);
+    }
+    state->jobs = (size_t) jobs;
+}
 
 void parse_opts(int argc, char **argv, State *state) {
     for (int i = 0; i < argc; i++) {
@@ -61,6 +145,16 @@ void parse_opts(int argc, char **argv, State *state) {
                 state->flag = FLAG_NoOp;
                 break;
             }
+            case FLAG_Jobs: {
+                parse_jobs(state, value);
+                state->flag = FLAG_NoOp;
+                break;
+            }
+            case FLAG_Range: {
+                parse_range(state, value);
+                state->flag = FLAG_NoOp;
+                break;
+            }
             case FLAG_NoOp: {
                 if (strcmp(value, SHORT_INPUT_FLAG) == 0) {
                     state->flag = FLAG_Input;
@@ -76,6 +170,27 @@ void parse_opts(int argc, char **argv, State *state) {
                     copy_to(&state->output, value + strlen(LONG_OUTPUT_FLAG) + 1);
                 } else if (strcmp(value, LONG_DRY_FLAG) == 0) {
                     state->dry = 1;
+                } else if (strstr(value, LONG_COMPRESS_FLAG) == value) {
+                    parse_compress(state, value + strlen(LONG_COMPRESS_FLAG) + 1);
+                } else if (strcmp(value, SHORT_JOBS_FLAG) == 0) {
+                    state->flag = FLAG_Jobs;
+                } else if (strstr(value, LONG_JOBS_FLAG) == value) {
+                    parse_jobs(state, value + strlen(LONG_JOBS_FLAG) + 1);
+                } else if (strcmp(value, LONG_LINK_FLAG) == 0) {
+                    state->link = 1;
+                } else if (strcmp(value, LONG_RESUME_FLAG) == 0) {
+                    state->resume = 1;
+                } else if (strcmp(value, LONG_COMPACT_FLAG) == 0) {
+                    state->compact = 1;
+                } else if (strcmp(value, LONG_STATS_FLAG) == 0) {
+                    state->stats = 1;
+                } else if (strcmp(value, LONG_RANGE_FLAG) == 0) {
+                    state->flag = FLAG_Range;
+                } else if (strstr(value, LONG_RANGE_FLAG) == value) {
+                    parse_range(state, value + strlen(LONG_RANGE_FLAG) + 1);
+                } else if (state->merge && value[0] != '-') {
+                    state->parts = (char **) realloc(state->parts, sizeof(char *) * (state->partLen + 1));
+                    state->parts[state->partLen++] = value;
                 }
                 break;
             }
@@ -93,17 +208,86 @@ int main(int argc, char **argv) {
     state->flag = FLAG_NoOp;
     state->in = NULL;
     state->out = NULL;
+    state->staged = NULL;
+    state->fixed = 0;
+    state->compress = OutputFormat_Plain;
+    state->jobs = Pool_default_workers();
+
+    state->dry = 0;
+    state->archive = 0;
+    state->link = 0;
+    state->matcher = NULL;
+    state->report = NULL;
+    state->resume = 0;
+    state->journal = NULL;
+    state->ranged = 0;
+    state->rangeStart = 0;
+    state->rangeLen = 0;
+    state->merge = 0;
+    state->parts = NULL;
+    state->partLen = 0;
+    state->stats = 0;
+    state->compressed = 0;
+    state->compact = 0;
+    state->uring = 0;
+
+    if (argc > 1 && strcmp(argv[1], MERGE_COMMAND) == 0) {
+        state->merge = 1;
+        parse_opts(argc - 2, argv + 2, state);
+        merge_slices(state);
+        free(state->parts);
+        free(state->output);
+        return 0;
+    }
 
     parse_opts(argc, argv, state);
+    if (state->dry) state->report = Report_init();
+
+    if ((state->input == NULL || strlen(state->input) == 0) && !isatty(STDIN_FILENO)) {
+        copy_to(&state->input, "-");
+    }
 
     if (state->input == NULL || strlen(state->input) == 0) {
         print_help(1);
+    } else if ((state->output == NULL || strlen(state->output) == 0) && is_stdin(state)) {
+        copy_to(&state->output, "-");
     } else if (state->output == NULL || strlen(state->output) == 0) {
         copy_to(&state->output, state->input);
     }
 
+    if (!is_stdin(state) && is_directory(state->input)) {
+        fix_directory(state);
+        if (state->report) Report_print(state->report, state->matcher, state->input, stdout);
+        Report_free(state->report);
+        fprintf(stderr, "Input: %s\nOutput: %s\n", state->input, state->output);
+        free(state->input);
+        free(state->output);
+        return 0;
+    }
+
+    if (state->compress == OutputFormat_Plain && ends_with(state->output, ".gz")) {
+        state->compress = OutputFormat_Gzip;
+    } else if (state->compress == OutputFormat_Plain && ends_with(state->output, ".zst")) {
+        state->compress = OutputFormat_Zstd;
+    }
+    if (!Output_supports(state->compress)) {
+        fprintf(stderr, "fixpq was built without requested output compression\n");
+        exit(1);
+    }
+
     open_in(state);
     fix_content(state);
+    if (state->report) Report_print(state->report, state->matcher, state->input, stdout);
+    Report_free(state->report);
+
+    if (is_stdin(state) || state->archive || state->compressed || state->dry || state->ranged) {
+        // stream is already consumed, isn't SQL, would be decompressed whole, only report or a slice is
+        // wanted, nothing left to tokenize
+        if (state->input) free(state->input);
+        if (state->output) free(state->output);
+        if (state->out) fclose(state->out);
+        return 0;
+    }
 
     Lexer *tokenizer = Lexer_init(state->input);
     Lexer_tokenize(tokenizer);
@@ -119,7 +303,7 @@ int main(int argc, char **argv) {
                 count += 1;
             token = token->left;
         }
-        printf("Tree size: %zu\n", count);
+        fprintf(stderr, "Tree size: %zu\n", count);
     }
 
     if (!Parser_is_ok(parser)) {
@@ -138,7 +322,7 @@ int main(int argc, char **argv) {
     Parser_free(parser);
     Lexer_free(tokenizer);
 
-    printf("Input: %s\nOutput: %s\n", state->input, state->output);
+    fprintf(stderr, "Input: %s\nOutput: %s\n", state->input, state->output);
 
     if (state->input) free(state->input);
     if (state->output) free(state->output);
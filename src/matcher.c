@@ -0,0 +1,205 @@
+#include <matcher.h>
+#include <scanner.h>
+
+static const char *COPY_SUFFIX = " FROM stdin;";
+
+static short match_rule(const Matcher *matcher, size_t rule, const char *data, size_t size, size_t start,
+                        short at_eof, Match *match);
+
+/**
+ * Every rule matches a whole line, or its beginning for prefix rules. Copy
+ * rule matches `COPY ... FROM stdin;` header, data following it up to `\.`
+ * line is skipped with terminator search alone. Each
+ * rule is anchored on the rarest byte of its pattern, preferring bytes other
+ * rules already use, so all rules are looked for in single scan over few
+ * bytes and only rules anchored on the byte found are verified around it.
+ */
+Matcher *Matcher_init(const MatchRule *rules, size_t len) {
+    char bytes[SCANNER_BYTES_MAX];
+    size_t byte_len = 0;
+
+    Matcher *matcher = (Matcher *) malloc(sizeof(Matcher));
+    memset(matcher, 0, sizeof(Matcher));
+    matcher->rules = rules;
+    matcher->ruleLen = len;
+    matcher->patternLens = (size_t *) malloc(sizeof(size_t) * len);
+    matcher->anchors = (size_t *) malloc(sizeof(size_t) * len);
+
+    for (size_t r = 0; r < len; r++) {
+        const unsigned char *pattern = (const unsigned char *) rules[r].pattern;
+        size_t pattern_len = strlen(rules[r].pattern);
+        if (pattern_len == 0) {
+            Matcher_free(matcher);
+            return NULL;
+        }
+
+        size_t best = 0;
+        for (size_t i = 1; i < pattern_len; i++) {
+            if (Scanner_rank(pattern[i]) > Scanner_rank(pattern[best]))
+                best = i;
+        }
+        for (size_t i = 0; i < pattern_len; i++) {
+            if (Scanner_rank(pattern[i]) == Scanner_rank(pattern[best]) && memchr(bytes, pattern[i], byte_len)) {
+                best = i;
+                break;
+            }
+        }
+        if (memchr(bytes, pattern[best], byte_len) == NULL) {
+            if (byte_len == SCANNER_BYTES_MAX) {
+                Matcher_free(matcher);
+                return NULL;
+            }
+            bytes[byte_len++] = (char) pattern[best];
+        }
+
+        matcher->patternLens[r] = pattern_len;
+        matcher->anchors[r] = best;
+        size_t line = rules[r].kind == MatchKind_Line ? pattern_len : rules[r].maxLen;
+        if (line > matcher->maxLine) matcher->maxLine = line;
+    }
+
+    matcher->scanner = Scanner_init(bytes, byte_len);
+    matcher->terminator = Scanner_init_pair('\\', '.');
+    return matcher;
+}
+
+void Matcher_free(Matcher *matcher) {
+    if (matcher == NULL)
+        return;
+    Scanner_free(matcher->scanner);
+    Scanner_free(matcher->terminator);
+    free(matcher->patternLens);
+    free(matcher->anchors);
+    free(matcher);
+}
+
+/**
+ * Find first line matching any rule at or after `from`. Both `data` and
+ * `from` must be at line start. Line running up to `size` is complete only
+ * `at_eof`, until then it never matches. `copy` tells whether `from` is
+ * inside COPY data and is updated when no more matches are left.
+ */
+short Matcher_next(const Matcher *matcher, const char *data, size_t size, size_t from, short at_eof, short *copy,
+                   Match *match) {
+    size_t pos = from;
+    if (*copy) {
+        if (!Matcher_copy_end(matcher, data, size, from, at_eof, &pos))
+            return 0;
+        *copy = 0;
+    }
+
+    size_t line = pos;
+    while (pos < size) {
+        size_t hit = pos + Scanner_find(matcher->scanner, data + pos, size - pos);
+        if (hit >= size)
+            return 0;
+        pos = hit + 1;
+        for (size_t r = 0; r < matcher->ruleLen; r++) {
+            size_t offset = matcher->anchors[r];
+            if (matcher->rules[r].pattern[offset] != data[hit] || hit - line < offset)
+                continue;
+            if (!match_rule(matcher, r, data, size, hit - offset, at_eof, match))
+                continue;
+            if (matcher->rules[r].kind != MatchKind_Copy)
+                return 1;
+
+            *copy = 1;
+            if (!Matcher_copy_end(matcher, data, size, match->end, at_eof, &pos))
+                return 0;
+            *copy = 0;
+            line = pos;
+            break;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Find `\.` line ending COPY data starting at line start `from`, `end` is
+ * set past it. Returns 0 when data doesn't end within `size`.
+ */
+short Matcher_copy_end(const Matcher *matcher, const char *data, size_t size, size_t from, short at_eof, size_t *end) {
+    size_t pos = from;
+    while (pos < size) {
+        size_t hit = pos + Scanner_find(matcher->terminator, data + pos, size - pos);
+        if (hit >= size)
+            return 0;
+        if (hit == 0 || data[hit - 1] == '\n') {
+            if (hit + 2 < size && data[hit + 2] == '\n') {
+                *end = hit + 3;
+                return 1;
+            }
+            if (hit + 2 == size && at_eof) {
+                *end = size;
+                return 1;
+            }
+        }
+        pos = hit + 1;
+    }
+    return 0;
+}
+
+/**
+ * Tell whether line start `from` is inside COPY data without looking back
+ * at what precedes it. It's inside when the next `\\.` line comes before
+ * any COPY header, data line looking exactly like a header fools it.
+ */
+short Matcher_copy_at(const Matcher *matcher, const char *data, size_t size, size_t from) {
+    size_t end;
+    if (!Matcher_copy_end(matcher, data, size, from, 1, &end))
+        return 0;
+    size_t terminator = end - 2 - (data[end - 1] == '\n');
+
+    short copy = 0;
+    Match match;
+    size_t pos = from;
+    while (Matcher_next(matcher, data, terminator, pos, 1, &copy, &match))
+        pos = match.end;
+    return !copy;
+}
+
+static short match_rule(const Matcher *matcher, size_t rule, const char *data, size_t size, size_t start,
+                        short at_eof, Match *match) {
+    const MatchRule *current = &matcher->rules[rule];
+    size_t pattern_len = matcher->patternLens[rule];
+    if (start > 0 && data[start - 1] != '\n')
+        return 0;
+    if (start + pattern_len > size || memcmp(data + start, current->pattern, pattern_len) != 0)
+        return 0;
+
+    size_t line_len = pattern_len;
+    size_t suffix_len = strlen(COPY_SUFFIX);
+    if (current->kind == MatchKind_Line) {
+        if (start + pattern_len < size ? data[start + pattern_len] != '\n' : !at_eof)
+            return 0;
+    } else if (current->kind == MatchKind_Copy) {
+        // header of wide table may be any length, one running past `size`
+        // that can't be carried whole is taken for header as it is
+        const char *nl = memchr(data + start + pattern_len, '\n', size - start - pattern_len);
+        if (nl != NULL)
+            line_len = (size_t) (nl - data) - start;
+        else if (at_eof || size - start > current->maxLen)
+            line_len = size - start;
+        else
+            return 0;
+        if ((nl != NULL || at_eof) &&
+            (line_len < pattern_len + suffix_len ||
+             memcmp(data + start + line_len - suffix_len, COPY_SUFFIX, suffix_len) != 0))
+            return 0;
+    } else {
+        size_t bound = start + current->maxLen + 1 < size ? start + current->maxLen + 1 : size;
+        const char *nl = memchr(data + start + pattern_len, '\n', bound - start - pattern_len);
+        if (nl != NULL)
+            line_len = (size_t) (nl - data) - start;
+        else if (at_eof && size - start <= current->maxLen)
+            line_len = size - start;
+        else
+            return 0;
+    }
+
+    match->rule = rule;
+    match->start = start;
+    match->len = line_len;
+    match->end = start + line_len + (start + line_len < size);
+    return 1;
+}
@@ -0,0 +1,326 @@
+#define _GNU_SOURCE
+
+#include <output.h>
+#include <pool.h>
+#include <errno.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#ifdef FIXPQ_WITH_ZLIB
+#include <zlib.h>
+#endif
+#ifdef FIXPQ_WITH_ZSTD
+#include <zstd.h>
+#endif
+
+#ifndef IOV_MAX
+#define IOV_MAX 1024
+#endif
+
+static const size_t OUTPUT_BLOCK_SIZE = 1 << 20;
+
+// shorter spans of source are written from memory together with the rest
+static const size_t COPY_RANGE_MIN = 1 << 16;
+
+static int write_spans(int fd, struct iovec *spans, size_t len);
+
+static int write_all(int fd, const char *data, size_t len);
+
+static short is_ranged(Output *out, const struct iovec *span);
+
+static int copy_range(Output *out, const struct iovec *span);
+
+static int submit_block(Output *out);
+
+static int drain_block(Output *out);
+
+static void compress_block(void *arg);
+
+/**
+ * Plain output writes spans as they are. Compressed output cuts data into
+ * independent blocks packed by `workers` threads as separate gzip members or
+ * zstd frames, which concatenated form valid stream.
+ */
+Output *Output_init(int fd, OutputFormat format, size_t workers) {
+    Output *out = (Output *) malloc(sizeof(Output));
+    memset(out, 0, sizeof(Output));
+    out->fd = fd;
+    out->source = -1;
+    out->format = format;
+    out->spanCap = IOV_MAX;
+    out->spans = (struct iovec *) malloc(sizeof(struct iovec) * out->spanCap);
+
+    if (format != OutputFormat_Plain) {
+        if (workers == 0) workers = 1;
+        out->pool = Pool_init(workers);
+        out->blockLen = workers * 2;
+        out->blocks = (OutputBlock *) malloc(sizeof(OutputBlock) * out->blockLen);
+        memset(out->blocks, 0, sizeof(OutputBlock) * out->blockLen);
+        for (size_t i = 0; i < out->blockLen; i++) {
+            out->blocks[i].format = format;
+            out->blocks[i].data = (char *) malloc(OUTPUT_BLOCK_SIZE);
+            out->blocks[i].task.run = compress_block;
+            out->blocks[i].task.arg = &out->blocks[i];
+        }
+    }
+    return out;
+}
+
+short Output_supports(OutputFormat format) {
+    switch (format) {
+        case OutputFormat_Gzip:
+#ifdef FIXPQ_WITH_ZLIB
+            return 1;
+#else
+            return 0;
+#endif
+        case OutputFormat_Zstd:
+#ifdef FIXPQ_WITH_ZSTD
+            return 1;
+#else
+            return 0;
+#endif
+        default:
+            return 1;
+    }
+}
+
+void Output_free(Output *out) {
+    if (out == NULL)
+        return;
+    if (out->pool) {
+        Pool_free(out->pool);
+        for (size_t i = 0; i < out->blockLen; i++) {
+            free(out->blocks[i].data);
+            if (out->blocks[i].packed) free(out->blocks[i].packed);
+        }
+        free(out->blocks);
+    }
+    if (out->spans) free(out->spans);
+    free(out);
+}
+
+/**
+ * Spans of plain output pointing into `data`, which is mapped file `fd`, are
+ * copied by kernel from the file instead, with `splice` when output is a pipe
+ * and `copy_file_range` otherwise, which may share blocks on reflink capable
+ * filesystems.
+ */
+void Output_source(Output *out, int fd, const char *data, size_t size) {
+    struct stat out_stat;
+    if (out->format != OutputFormat_Plain || fstat(out->fd, &out_stat) != 0)
+        return;
+    out->source = fd;
+    out->sourceData = data;
+    out->sourceSize = size;
+    out->splice = S_ISFIFO(out_stat.st_mode);
+}
+
+/**
+ * Queue `len` bytes starting at `data` for writing. Plain output doesn't
+ * copy them, caller must keep them alive until next `Output_flush`, spans
+ * are collected until then however many there are.
+ */
+int Output_write(Output *out, const char *data, size_t len) {
+    if (len == 0)
+        return 0;
+    out->written += len;
+
+    if (out->format != OutputFormat_Plain) {
+        while (len > 0) {
+            OutputBlock *block = &out->blocks[(out->head + out->inFlight) % out->blockLen];
+            size_t n = OUTPUT_BLOCK_SIZE - block->len;
+            if (n > len) n = len;
+            memcpy(block->data + block->len, data, n);
+            block->len += n;
+            data += n;
+            len -= n;
+            if (block->len == OUTPUT_BLOCK_SIZE && submit_block(out) != 0)
+                return -1;
+        }
+        return 0;
+    }
+
+    if (out->spanLen == out->spanCap) {
+        out->spanCap *= 2;
+        out->spans = (struct iovec *) realloc(out->spans, sizeof(struct iovec) * out->spanCap);
+    }
+    out->spans[out->spanLen].iov_base = (void *) data;
+    out->spans[out->spanLen].iov_len = len;
+    out->spanLen += 1;
+    return 0;
+}
+
+/**
+ * Write queued spans, compressed output already holds its own copy so
+ * blocks are packed once full or on `Output_finish`.
+ */
+int Output_flush(Output *out) {
+    int status = 0;
+    size_t start = 0;
+    for (size_t i = 0; i < out->spanLen && status == 0; i++) {
+        if (!is_ranged(out, &out->spans[i]))
+            continue;
+        status = write_spans(out->fd, out->spans + start, i - start);
+        if (status == 0) status = copy_range(out, &out->spans[i]);
+        start = i + 1;
+    }
+    if (status == 0) status = write_spans(out->fd, out->spans + start, out->spanLen - start);
+    out->spanLen = 0;
+    return status;
+}
+
+/**
+ * Write everything including last partial block. Empty compressed output
+ * still gets one empty member or frame, zero bytes aren't a valid stream.
+ */
+int Output_finish(Output *out) {
+    if (out->format == OutputFormat_Plain)
+        return Output_flush(out);
+
+    OutputBlock *block = &out->blocks[(out->head + out->inFlight) % out->blockLen];
+    if ((block->len > 0 || out->written == 0) && submit_block(out) != 0)
+        return -1;
+    while (out->inFlight > 0) {
+        if (drain_block(out) != 0)
+            return -1;
+    }
+    return 0;
+}
+
+static int submit_block(Output *out) {
+    OutputBlock *block = &out->blocks[(out->head + out->inFlight) % out->blockLen];
+    Pool_submit(out->pool, &block->task);
+    out->inFlight += 1;
+    if (out->inFlight == out->blockLen)
+        return drain_block(out);
+    return 0;
+}
+
+/**
+ * Wait for the oldest block and write it, keeps output in order.
+ */
+static int drain_block(Output *out) {
+    OutputBlock *block = &out->blocks[out->head];
+    Pool_wait(out->pool, &block->task);
+    out->head = (out->head + 1) % out->blockLen;
+    out->inFlight -= 1;
+
+    block->len = 0;
+    if (block->failed)
+        return -1;
+    return write_all(out->fd, block->packed, block->packedLen);
+}
+
+static void compress_block(void *arg) {
+    OutputBlock *block = (OutputBlock *) arg;
+    block->failed = 1;
+    block->packedLen = 0;
+
+    switch (block->format) {
+        case OutputFormat_Gzip: {
+#ifdef FIXPQ_WITH_ZLIB
+            z_stream z;
+            memset(&z, 0, sizeof(z_stream));
+            if (deflateInit2(&z, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+                return;
+            size_t bound = deflateBound(&z, OUTPUT_BLOCK_SIZE);
+            if (block->packed == NULL) block->packed = (char *) malloc(bound);
+            z.next_in = (Bytef *) block->data;
+            z.avail_in = (uInt) block->len;
+            z.next_out = (Bytef *) block->packed;
+            z.avail_out = (uInt) bound;
+            if (deflate(&z, Z_FINISH) == Z_STREAM_END) {
+                block->packedLen = bound - z.avail_out;
+                block->failed = 0;
+            }
+            deflateEnd(&z);
+#endif
+            break;
+        }
+        case OutputFormat_Zstd: {
+#ifdef FIXPQ_WITH_ZSTD
+            size_t bound = ZSTD_compressBound(OUTPUT_BLOCK_SIZE);
+            if (block->packed == NULL) block->packed = (char *) malloc(bound);
+            size_t len = ZSTD_compress(block->packed, bound, block->data, block->len, ZSTD_CLEVEL_DEFAULT);
+            if (!ZSTD_isError(len)) {
+                block->packedLen = len;
+                block->failed = 0;
+            }
+#endif
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+static int write_all(int fd, const char *data, size_t len) {
+    while (len > 0) {
+        ssize_t n = write(fd, data, len);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n < 0)
+            return -1;
+        data += n;
+        len -= (size_t) n;
+    }
+    return 0;
+}
+
+static int write_spans(int fd, struct iovec *spans, size_t len) {
+    while (len > 0) {
+        ssize_t n = writev(fd, spans, len > IOV_MAX ? IOV_MAX : (int) len);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            return -1;
+        }
+        while (len > 0 && (size_t) n >= spans->iov_len) {
+            n -= (ssize_t) spans->iov_len;
+            spans += 1;
+            len -= 1;
+        }
+        if (len > 0) {
+            spans->iov_base = (char *) spans->iov_base + n;
+            spans->iov_len -= (size_t) n;
+        }
+    }
+    return 0;
+}
+
+static short is_ranged(Output *out, const struct iovec *span) {
+    const char *base = (const char *) span->iov_base;
+    return out->source >= 0 && span->iov_len >= COPY_RANGE_MIN && base >= out->sourceData &&
+           base + span->iov_len <= out->sourceData + out->sourceSize;
+}
+
+/**
+ * Copy span from source file. When kernel can't do it for these files
+ * nothing is copied, remaining bytes and later spans are written from memory.
+ */
+static int copy_range(Output *out, const struct iovec *span) {
+    const char *base = (const char *) span->iov_base;
+    loff_t offset = base - out->sourceData;
+    size_t done = 0;
+    while (done < span->iov_len && out->source >= 0) {
+        ssize_t n = out->splice
+                    ? splice(out->source, &offset, out->fd, NULL, span->iov_len - done, SPLICE_F_MOVE)
+                    : copy_file_range(out->source, &offset, out->fd, NULL, span->iov_len - done, 0);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n < 0 && done == 0 && (errno == EXDEV || errno == EINVAL || errno == ENOSYS ||
+                                   errno == EOPNOTSUPP || errno == EBADF)) {
+            out->source = -1;
+            break;
+        }
+        if (n < 0)
+            return -1;
+        if (n == 0)
+            break;
+        done += (size_t) n;
+    }
+    return write_all(out->fd, base + done, span->iov_len - done);
+}
@@ -1,4 +1,5 @@
 #include <parser.h>
+#include <lexer.h>
 
 void Parser_free_token(ParserToken *token);
 
@@ -8,7 +9,7 @@ static ParserToken *consume(Parser *parser);
 
 // Utils
 
-static void store_str(Parser *parser, ParserToken *token, wchar_t *str, short sep);
+static void store_str(Parser *parser, ParserToken *token, const LexerToken *lexerToken, short sep);
 
 static void parse_error(Parser *parser, ParserError error);
 
@@ -17,7 +18,7 @@ static ParserToken *first_keyword_in_tree(ParserToken *root, short stop_on_semic
 // Matchers
 static short is_number(const wchar_t *b);
 
-static short peek_n(const Parser *parser, size_t n, LexerToken const *lexerTokens[]);
+static short peek_n(const Parser *parser, size_t n, LexerToken lexerTokens[]);
 
 static short is_inline_comment(const Parser *parser);
 
@@ -53,8 +54,10 @@ static ParserToken *consume_assign(Parser *parser, ParserToken *token);
 Parser *Parser_init(Lexer *lexer) {
     Parser *parser = (Parser *) malloc(sizeof(Parser));
     memset(parser, 0, sizeof(Parser));
-    parser->tokens = lexer->tokens;
+    parser->lexer = lexer;
     parser->tokenLen = lexer->tokenLen;
+    if (lexer->failed)
+        parser->error = ParserError_AllocFailed;
     return parser;
 }
 
@@ -80,7 +83,7 @@ int Parser_parse(Parser *parser) {
 static ParserToken *ParserToken_new(LexerToken *lexerToken) {
     ParserToken *token = (ParserToken *) malloc(sizeof(ParserToken));
     memset(token, 0, sizeof(ParserToken));
-    token->lexerToken = lexerToken;
+    token->lexerToken = *lexerToken;
     token->type = ParserType_Create;
     token->position.line = lexerToken->position.line;
     token->position.character = lexerToken->position.character;
@@ -98,10 +101,9 @@ static ParserToken *consume(Parser *parser) {
     if (parser->position >= parser->tokenLen)
         return NULL;
 
-    LexerToken *current = parser->tokens[parser->position];
+    LexerToken token = Lexer_token(parser->lexer, parser->position);
+    LexerToken *current = &token;
     ParserToken *root = parser->ast;
-    if (current == NULL)
-        return root;
 
     switch (current->type) {
         case LexerType_Keyword:
@@ -129,39 +131,39 @@ static ParserToken *consume_lexer_keyword(Parser *parser, LexerToken *lexerToken
     ParserToken *token = NULL;
     ParserToken *root = parser->ast;
 
-    if (wcscmp(lexerToken->str, L"SELECT") == 0) {
+    if (LexerToken_iequals(parser->lexer, lexerToken, "SELECT")) {
         token = ParserToken_new(lexerToken);
         token->type = ParserType_Select;
         token->left = root;
         parser->ast = token;
-    } else if (wcscmp(lexerToken->str, L"CREATE") == 0) {
+    } else if (LexerToken_iequals(parser->lexer, lexerToken, "CREATE")) {
         token = ParserToken_new(lexerToken);
         token->type = ParserType_Create;
         token->left = root;
         parser->ast = token;
-    } else if (wcscmp(lexerToken->str, L"ALTER") == 0) {
+    } else if (LexerToken_iequals(parser->lexer, lexerToken, "ALTER")) {
         token = ParserToken_new(lexerToken);
         token->type = ParserType_Alter;
         token->left = root;
         parser->ast = token;
-    } else if (wcscmp(lexerToken->str, L"DROP") == 0) {
+    } else if (LexerToken_iequals(parser->lexer, lexerToken, "DROP")) {
         token = ParserToken_new(lexerToken);
         token->type = ParserType_Drop;
         token->left = root;
         parser->ast = token;
-    } else if (wcscmp(lexerToken->str, L"TABLE") == 0) {
+    } else if (LexerToken_iequals(parser->lexer, lexerToken, "TABLE")) {
         ParserToken *current = ParserToken_new(lexerToken);
         current->type = ParserType_Table;
         token = consume_table_token(parser, current);
-    } else if (wcscmp(lexerToken->str, L"FUNCTION") == 0) {
+    } else if (LexerToken_iequals(parser->lexer, lexerToken, "FUNCTION")) {
         ParserToken *current = ParserToken_new(lexerToken);
         current->type = ParserType_Function;
         token = consume_function_token(parser, current);
-    } else if (wcscmp(lexerToken->str, L"EXTENSION") == 0) {
+    } else if (LexerToken_iequals(parser->lexer, lexerToken, "EXTENSION")) {
         ParserToken *current = ParserToken_new(lexerToken);
         current->type = ParserType_Extension;
         token = consume_extension_token(parser, current);
-    } else if (wcscmp(lexerToken->str, L"FROM") == 0) {
+    } else if (LexerToken_iequals(parser->lexer, lexerToken, "FROM")) {
         token = ParserToken_new(lexerToken);
         token->type = ParserType_Select;
         token->left = root;
@@ -176,7 +178,7 @@ static ParserToken *consume_lexer_identifier(Parser *parser, LexerToken *lexerTo
     ParserToken *root = parser->ast;
     ParserToken *token = ParserToken_new(lexerToken);
     token->type = ParserType_Identifier;
-    store_str(parser, token, lexerToken->str, 0);
+    store_str(parser, token, lexerToken, 0);
 
     if (!root) {
         token->left = root;
@@ -209,15 +211,15 @@ static ParserToken *consume_lexer_operator(Parser *parser, LexerToken *lexerToke
     token->left = root;
     parser->ast = NULL;
 
-    switch (*lexerToken->str) {
-        case L'=':
+    switch (*LexerToken_text(parser->lexer, lexerToken)) {
+        case '=':
             return consume_assign(parser, token);
-        case L'+':
+        case '+':
             token->type = ParserType_Add;
             break;
-        case L'-':
+        case '-':
             return consume_subtraction(parser, token);
-        case L'*': {
+        case '*': {
             ParserToken *keyword = first_keyword_in_tree(root, 1);
             if (keyword != NULL && keyword->type == ParserType_Select) {
                 token->type = ParserType_Star;
@@ -227,15 +229,15 @@ static ParserToken *consume_lexer_operator(Parser *parser, LexerToken *lexerToke
             }
             break;
         }
-        case L'/':
+        case '/':
             return consume_divide(parser, token);
-        case L'%':
+        case '%':
             token->type = ParserType_Modulo;
             break;
-        case L'|':
+        case '|':
             token->type = ParserType_BinaryOr;
             break;
-        case L'&':
+        case '&':
             token->type = ParserType_BinaryAnd;
             break;
         default:
@@ -253,26 +255,26 @@ static ParserToken *consume_lexer_separator(Parser *parser, LexerToken *lexerTok
     token->left = root;
     parser->ast = NULL;
 
-    switch (*lexerToken->str) {
-        case L';':
+    switch (*LexerToken_text(parser->lexer, lexerToken)) {
+        case ';':
             token->type = ParserType_Semicolon;
             break;
-        case L'<':
+        case '<':
             token->type = ParserType_Smaller;
             break;
-        case L'>':
+        case '>':
             token->type = ParserType_Larger;
             break;
-        case L'(':
+        case '(':
             token->type = ParserType_LeftParenthesis;
             break;
-        case L')':
+        case ')':
             token->type = ParserType_RightParenthesis;
             break;
-        case L'.':
+        case '.':
             token->type = ParserType_Dot;
             break;
-        case L',':
+        case ',':
             token->type = ParserType_Comma;
             break;
         default:
@@ -340,54 +342,48 @@ static ParserToken *consume_inline_comment(Parser *parser, ParserToken *token) {
     parser->position += 1;
     const size_t line = token->position.line;
 
-    LexerToken **head = parser->tokens + parser->position;
-    LexerToken **it = parser->tokens + parser->position;
-    LexerToken **tail = NULL;
-    LexerToken **last_in_line = NULL;
+    const size_t head = parser->position;
+    size_t tail = head;
 
     while (Parser_is_ok(parser)) {
-        LexerToken *current = *it;
-
-        if (current == NULL)
-            break;
+        LexerToken current = Lexer_token(parser->lexer, parser->position);
 
-        if (current->position.line != line) {
+        if (current.position.line != line) {
             parser->position -= 1;
             break;
         } else {
-            it = it + 1;
+            tail += 1;
             parser->position += 1;
         }
     }
 
-    if (head != NULL && it != NULL && head != it) {
-        tail = it;
-        it = head;
-        last_in_line = tail - 1;
-        size_t from = (*head)->position.character;
-        size_t last_in_line_len = (*last_in_line)->str ? wcslen((*last_in_line)->str) : 1;
-        size_t line_len = (*(tail - 1))->position.character - (*head)->position.character + last_in_line_len;
+    if (head != tail) {
+        LexerToken first = Lexer_token(parser->lexer, head);
+        LexerToken last_in_line = Lexer_token(parser->lexer, tail - 1);
+        size_t from = first.position.character;
+        wchar_t *last_str = LexerToken_wcs(parser->lexer, &last_in_line);
+        size_t last_in_line_len = wcslen(last_str);
+        free(last_str);
+        size_t line_len = last_in_line.position.character - first.position.character + last_in_line_len;
         token->str = malloc(sizeof(wchar_t) * (line_len + 1));
         for (size_t i = 0; i < line_len; i++) token->str[i] = L' ';
         token->str[line_len] = 0;
 
         size_t size = 0;
-        for (; it != tail;) {
-            LexerToken *c = *it;
+        for (size_t it = head; it != tail; it++) {
+            LexerToken c = Lexer_token(parser->lexer, it);
             wchar_t *dest = token->str;
-            wchar_t *src = c->str;
-            size_t pad = c->position.character - from;
-            size_t len = src ? wcslen(src) : 0;
+            wchar_t *src = LexerToken_wcs(parser->lexer, &c);
+            size_t pad = c.position.character - from;
+            size_t len = wcslen(src);
             if (len && size + len > line_len) {
                 printf("Out of bound memory write!");
                 exit(9);
             } else {
                 size += len;
             }
-            if (src) {
-                wcsncpy(dest + pad, src, len);
-            }
-            it = it + 1;
+            wcsncpy(dest + pad, src, len);
+            free(src);
         }
     }
 
@@ -398,9 +394,9 @@ static ParserToken *consume_lexer_literal(Parser *parser, LexerToken *lexerToken
     ParserToken *root = parser->ast;
     ParserToken *token = ParserToken_new(lexerToken);
     parser->ast = token;
-    store_str(parser, token, lexerToken->str, 0);
+    store_str(parser, token, lexerToken, 0);
 
-    if (is_number(lexerToken->str)) {
+    if (is_number(token->str)) {
         token->type = ParserType_Number;
     }
     if (next_is_lexer_type(parser, LexerType_Operator)) {
@@ -479,17 +475,17 @@ static ParserToken *consume_extension_token(Parser *parser, ParserToken *token)
 }
 
 // Utils
-static void store_str(Parser *parser, ParserToken *token, wchar_t *str, short sep) {
-    if (str == NULL && token->str == NULL)
+static void store_str(Parser *parser, ParserToken *token, const LexerToken *lexerToken, short sep) {
+    if (lexerToken == NULL && token->str == NULL)
         return;
 
+    wchar_t *str = lexerToken ? LexerToken_wcs(parser->lexer, lexerToken) : NULL;
     const size_t given_len = str ? wcslen(str) : 0;
     size_t old_len = token->str ? wcslen(token->str) : 0;
 
     if (token->str == NULL) {
-        token->str = (wchar_t *) malloc(sizeof(wchar_t) * (given_len + 1));
-        memset(token->str, 0, given_len + 1);
-        if (str) wcscpy(token->str, str);
+        token->str = str;
+        str = NULL;
     } else if (sep || str != NULL) {
         size_t len = old_len + given_len + (sep ? 1 : 0) + 1;
         wchar_t *new_block = (wchar_t *) realloc(token->str, sizeof(wchar_t) * len);
@@ -508,6 +504,7 @@ static void store_str(Parser *parser, ParserToken *token, wchar_t *str, short se
             wcscat(token->str, str);
         token->str[len - 1] = 0;
     }
+    free(str);
     token->position.character += 1;
 }
 
@@ -519,7 +516,7 @@ static void parse_error(Parser *parser, ParserError error) {
 static ParserToken *first_keyword_in_tree(ParserToken *root, short stop_on_semicolon) {
     if (root == NULL)
         return NULL;
-    if (root->lexerToken->type == LexerType_Keyword)
+    if (root->lexerToken.type == LexerType_Keyword)
         return root;
     if (stop_on_semicolon && wcscmp(root->str, L";") == 0)
         return NULL;
@@ -548,27 +545,24 @@ static short is_number(const wchar_t *b) {
     return 1;
 }
 
-static short peek_n(const Parser *parser, size_t n, LexerToken const *lexerTokens[]) {
+static short peek_n(const Parser *parser, size_t n, LexerToken lexerTokens[]) {
     if (parser->tokenLen <= parser->position + n)
         return 0;
     for (size_t i = 0; i < n; i++) {
-        lexerTokens[i] = parser->tokens[parser->position + i];
+        lexerTokens[i] = Lexer_token(parser->lexer, parser->position + i);
     }
     return 1;
 }
 
 static short is_inline_comment(const Parser *parser) {
-    LexerToken const *lexerTokens[1];
+    LexerToken lexerTokens[1];
     if (peek_n(parser, 1, lexerTokens) == 0)
         return 0;
-    return lexerTokens[0]->type == LexerType_Operator && wcscmp(lexerTokens[0]->str, L"-") == 0;
+    return lexerTokens[0].type == LexerType_Operator && LexerToken_equals(parser->lexer, &lexerTokens[0], "-");
 }
 
 static short next_is_lexer_type(const Parser *parser, LexerType lexerType) {
     if (parser->position + 1 >= parser->tokenLen)
         return 0;
-    LexerToken *lexerToken = parser->tokens[parser->position + 1];
-    if (lexerToken == NULL)
-        return 0;
-    return lexerToken->type == lexerType;
+    return Lexer_token(parser->lexer, parser->position + 1).type == lexerType;
 }
@@ -0,0 +1,96 @@
+#include <pool.h>
+#include <unistd.h>
+
+static void *work(void *arg);
+
+Pool *Pool_init(size_t workers) {
+    Pool *pool = (Pool *) malloc(sizeof(Pool));
+    memset(pool, 0, sizeof(Pool));
+    if (workers == 0) workers = 1;
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->queued, NULL);
+    pthread_cond_init(&pool->finished, NULL);
+    pool->threads = (pthread_t *) malloc(sizeof(pthread_t) * workers);
+    for (size_t i = 0; i < workers; i++) {
+        if (pthread_create(&pool->threads[pool->threadLen], NULL, work, pool) == 0)
+            pool->threadLen += 1;
+    }
+    return pool;
+}
+
+/**
+ * Finish queued tasks and stop workers.
+ */
+void Pool_free(Pool *pool) {
+    if (pool == NULL)
+        return;
+    pthread_mutex_lock(&pool->lock);
+    pool->closed = 1;
+    pthread_cond_broadcast(&pool->queued);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (size_t i = 0; i < pool->threadLen; i++)
+        pthread_join(pool->threads[i], NULL);
+
+    pthread_cond_destroy(&pool->finished);
+    pthread_cond_destroy(&pool->queued);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->threads);
+    free(pool);
+}
+
+/**
+ * Queue task, it's owned by the caller and must stay alive until `Pool_wait`.
+ */
+void Pool_submit(Pool *pool, PoolTask *task) {
+    task->done = 0;
+    task->next = NULL;
+    if (pool->threadLen == 0) {
+        task->run(task->arg);
+        task->done = 1;
+        return;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    if (pool->tail) pool->tail->next = task;
+    else pool->head = task;
+    pool->tail = task;
+    pthread_cond_signal(&pool->queued);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+void Pool_wait(Pool *pool, PoolTask *task) {
+    pthread_mutex_lock(&pool->lock);
+    while (!task->done)
+        pthread_cond_wait(&pool->finished, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+size_t Pool_default_workers() {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    return cpus > 0 ? (size_t) cpus : 1;
+}
+
+static void *work(void *arg) {
+    Pool *pool = (Pool *) arg;
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        while (pool->head == NULL && !pool->closed)
+            pthread_cond_wait(&pool->queued, &pool->lock);
+        if (pool->head == NULL)
+            break;
+
+        PoolTask *task = pool->head;
+        pool->head = task->next;
+        if (pool->head == NULL) pool->tail = NULL;
+        pthread_mutex_unlock(&pool->lock);
+
+        task->run(task->arg);
+
+        pthread_mutex_lock(&pool->lock);
+        task->done = 1;
+        pthread_cond_broadcast(&pool->finished);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
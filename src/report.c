@@ -0,0 +1,108 @@
+#include <report.h>
+
+/**
+ * Dry run collects matches instead of printing each one. Input is followed
+ * by `cursor` pointing at byte `offset` of it, newlines are counted only
+ * between cursor and next match or end of block it's moved to.
+ */
+
+static void print_str(FILE *out, const char *str);
+
+Report *Report_init() {
+    Report *report = (Report *) malloc(sizeof(Report));
+    memset(report, 0, sizeof(Report));
+    clock_gettime(CLOCK_MONOTONIC, &report->started);
+    return report;
+}
+
+void Report_free(Report *report) {
+    if (report == NULL)
+        return;
+    if (report->hits) free(report->hits);
+    free(report);
+}
+
+/**
+ * Start following new input at `at`, which is `offset` bytes into it.
+ */
+void Report_seek(Report *report, const char *at, size_t offset) {
+    report->cursor = at;
+    report->offset = offset;
+    report->line = 0;
+}
+
+/**
+ * Count bytes up to `end` as scanned, following bytes are at `next` from
+ * now on, e.g. once they are moved to the beginning of buffer.
+ */
+void Report_move(Report *report, const char *end, const char *next) {
+    if (report->cursor != NULL) {
+        const char *at = report->cursor;
+        while (at < end && (at = memchr(at, '\n', (size_t) (end - at))) != NULL) {
+            report->line += 1;
+            at += 1;
+        }
+        report->offset += (size_t) (end - report->cursor);
+        report->scanned += (size_t) (end - report->cursor);
+    }
+    report->cursor = next;
+}
+
+void Report_add(Report *report, size_t rule, const char *at) {
+    Report_move(report, at, at);
+    if (report->hitLen == report->hitCap) {
+        report->hitCap = report->hitCap ? report->hitCap * 2 : 64;
+        report->hits = (ReportHit *) realloc(report->hits, sizeof(ReportHit) * report->hitCap);
+    }
+    ReportHit *hit = &report->hits[report->hitLen++];
+    hit->rule = rule;
+    hit->offset = report->offset;
+    hit->line = report->line + 1;
+}
+
+/**
+ * Single JSON object with match count of every rule and position of every
+ * match in input order.
+ */
+void Report_print(Report *report, const Matcher *matcher, const char *input, FILE *out) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    double elapsed = (double) (now.tv_sec - report->started.tv_sec) +
+                     (double) (now.tv_nsec - report->started.tv_nsec) / 1e9;
+
+    fprintf(out, "{\"input\": ");
+    print_str(out, input);
+    fprintf(out, ", \"bytes_scanned\": %zu, \"elapsed_seconds\": %.6f, \"matches\": %zu, \"rules\": {",
+            report->scanned, elapsed, report->hitLen);
+    size_t printed = 0;
+    for (size_t r = 0; matcher && r < matcher->ruleLen; r++) {
+        if (matcher->rules[r].kind == MatchKind_Copy)
+            continue;
+        size_t count = 0;
+        for (size_t i = 0; i < report->hitLen; i++)
+            count += report->hits[i].rule == r;
+        if (printed++) fputs(", ", out);
+        print_str(out, matcher->rules[r].name);
+        fprintf(out, ": %zu", count);
+    }
+    fprintf(out, "}, \"hits\": [");
+    for (size_t i = 0; i < report->hitLen; i++) {
+        fputs(i ? ", {\"rule\": " : "{\"rule\": ", out);
+        print_str(out, matcher->rules[report->hits[i].rule].name);
+        fprintf(out, ", \"offset\": %zu, \"line\": %zu}", report->hits[i].offset, report->hits[i].line);
+    }
+    fprintf(out, "]}\n");
+}
+
+static void print_str(FILE *out, const char *str) {
+    fputc('"', out);
+    for (const unsigned char *c = (const unsigned char *) str; *c; c++) {
+        if (*c == '"' || *c == '\\')
+            fprintf(out, "\\%c", *c);
+        else if (*c < 0x20)
+            fprintf(out, "\\u%04x", *c);
+        else
+            fputc(*c, out);
+    }
+    fputc('"', out);
+}
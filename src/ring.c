@@ -0,0 +1,49 @@
+#include <ring.h>
+
+/**
+ * Lock-free ring passing pointers from one producer thread to one consumer
+ * thread. Each side only stores its own index, release store publishes slot
+ * written before it to the other side.
+ */
+Ring *Ring_init(size_t cap) {
+    Ring *ring = (Ring *) malloc(sizeof(Ring));
+    memset(ring, 0, sizeof(Ring));
+    ring->cap = 1;
+    while (ring->cap < cap)
+        ring->cap *= 2;
+    ring->items = (void **) malloc(sizeof(void *) * ring->cap);
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+    return ring;
+}
+
+void Ring_free(Ring *ring) {
+    if (ring == NULL)
+        return;
+    free(ring->items);
+    free(ring);
+}
+
+/**
+ * Returns 0 when ring is full.
+ */
+short Ring_push(Ring *ring, void *item) {
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    if (tail - atomic_load_explicit(&ring->head, memory_order_acquire) == ring->cap)
+        return 0;
+    ring->items[tail & (ring->cap - 1)] = item;
+    atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+    return 1;
+}
+
+/**
+ * Returns 0 when ring is empty.
+ */
+short Ring_pop(Ring *ring, void **item) {
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    if (head == atomic_load_explicit(&ring->tail, memory_order_acquire))
+        return 0;
+    *item = ring->items[head & (ring->cap - 1)];
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+    return 1;
+}
@@ -0,0 +1,171 @@
+#include <scanner.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SCANNER_X86
+#endif
+
+static size_t find_scalar(const Scanner *scanner, const char *data, size_t size);
+
+static size_t find_pair_scalar(const Scanner *scanner, const char *data, size_t size);
+
+#ifdef SCANNER_X86
+static size_t find_sse(const Scanner *scanner, const char *data, size_t size);
+
+static size_t find_avx2(const Scanner *scanner, const char *data, size_t size);
+
+static size_t find_pair_avx2(const Scanner *scanner, const char *data, size_t size);
+#endif
+
+/**
+ * Look for any of few anchor `bytes` comparing whole vector against each of
+ * them at once, vectors without any anchor are skipped without looking at
+ * single bytes. Returns NULL for no or more than `SCANNER_BYTES_MAX` bytes.
+ */
+Scanner *Scanner_init(const char *bytes, size_t len) {
+    if (len == 0 || len > SCANNER_BYTES_MAX)
+        return NULL;
+    Scanner *scanner = (Scanner *) malloc(sizeof(Scanner));
+    memset(scanner, 0, sizeof(Scanner));
+    memcpy(scanner->bytes, bytes, len);
+    scanner->len = len;
+    for (size_t i = 0; i < len; i++)
+        scanner->table[(unsigned char) bytes[i]] = 1;
+
+    scanner->find = find_scalar;
+#ifdef SCANNER_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        scanner->find = find_avx2;
+    else if (__builtin_cpu_supports("sse4.2"))
+        scanner->find = find_sse;
+#endif
+    return scanner;
+}
+
+/**
+ * Look for `first` byte immediately followed by `second` one, pair is
+ * much rarer than either byte alone.
+ */
+Scanner *Scanner_init_pair(char first, char second) {
+    Scanner *scanner = (Scanner *) malloc(sizeof(Scanner));
+    memset(scanner, 0, sizeof(Scanner));
+    scanner->bytes[0] = (unsigned char) first;
+    scanner->bytes[1] = (unsigned char) second;
+    scanner->len = 2;
+
+    scanner->find = find_pair_scalar;
+#ifdef SCANNER_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        scanner->find = find_pair_avx2;
+#endif
+    return scanner;
+}
+
+void Scanner_free(Scanner *scanner) {
+    if (scanner == NULL)
+        return;
+    free(scanner);
+}
+
+/**
+ * Offset of first anchor byte or pair in `data`, `size` if there is none.
+ */
+size_t Scanner_find(const Scanner *scanner, const char *data, size_t size) {
+    return scanner->find(scanner, data, size);
+}
+
+/**
+ * Whitespace and lowercase text dominate dumps, punctuation is frequent in
+ * data, uppercase keywords are the rarest.
+ */
+int Scanner_rank(unsigned char c) {
+    if (c == ' ' || c == '\n' || c == '\t')
+        return 0;
+    if ((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9'))
+        return 1;
+    if (c >= 'A' && c <= 'Z')
+        return 3;
+    return 2;
+}
+
+static size_t find_scalar(const Scanner *scanner, const char *data, size_t size) {
+    if (scanner->len == 1) {
+        const char *at = memchr(data, scanner->bytes[0], size);
+        return at ? (size_t) (at - data) : size;
+    }
+    for (size_t pos = 0; pos < size; pos++) {
+        if (scanner->table[(unsigned char) data[pos]])
+            return pos;
+    }
+    return size;
+}
+
+static size_t find_pair_scalar(const Scanner *scanner, const char *data, size_t size) {
+    const char *at = data;
+    const char *end = data + size;
+    while (at + 1 < end && (at = memchr(at, scanner->bytes[0], (size_t) (end - at - 1))) != NULL) {
+        if ((unsigned char) at[1] == scanner->bytes[1])
+            return (size_t) (at - data);
+        at += 1;
+    }
+    return size;
+}
+
+#ifdef SCANNER_X86
+__attribute__((target("sse4.2")))
+static size_t find_sse(const Scanner *scanner, const char *data, size_t size) {
+    __m128i anchors[SCANNER_BYTES_MAX];
+    for (size_t i = 0; i < scanner->len; i++)
+        anchors[i] = _mm_set1_epi8((char) scanner->bytes[i]);
+
+    size_t pos = 0;
+    for (; pos + 16 <= size; pos += 16) {
+        __m128i block = _mm_loadu_si128((const __m128i *) (data + pos));
+        __m128i hits = _mm_cmpeq_epi8(block, anchors[0]);
+        for (size_t i = 1; i < scanner->len; i++)
+            hits = _mm_or_si128(hits, _mm_cmpeq_epi8(block, anchors[i]));
+        unsigned mask = (unsigned) _mm_movemask_epi8(hits);
+        if (mask != 0)
+            return pos + (size_t) __builtin_ctz(mask);
+    }
+    return pos + find_scalar(scanner, data + pos, size - pos);
+}
+
+__attribute__((target("avx2")))
+static size_t find_avx2(const Scanner *scanner, const char *data, size_t size) {
+    __m256i anchors[SCANNER_BYTES_MAX];
+    for (size_t i = 0; i < scanner->len; i++)
+        anchors[i] = _mm256_set1_epi8((char) scanner->bytes[i]);
+
+    size_t pos = 0;
+    for (; pos + 32 <= size; pos += 32) {
+        __m256i block = _mm256_loadu_si256((const __m256i *) (data + pos));
+        __m256i hits = _mm256_cmpeq_epi8(block, anchors[0]);
+        for (size_t i = 1; i < scanner->len; i++)
+            hits = _mm256_or_si256(hits, _mm256_cmpeq_epi8(block, anchors[i]));
+        unsigned mask = (unsigned) _mm256_movemask_epi8(hits);
+        if (mask != 0)
+            return pos + (size_t) __builtin_ctz(mask);
+    }
+    return pos + find_scalar(scanner, data + pos, size - pos);
+}
+
+__attribute__((target("avx2")))
+static size_t find_pair_avx2(const Scanner *scanner, const char *data, size_t size) {
+    const __m256i first = _mm256_set1_epi8((char) scanner->bytes[0]);
+    const __m256i second = _mm256_set1_epi8((char) scanner->bytes[1]);
+
+    size_t pos = 0;
+    for (; pos + 33 <= size; pos += 32) {
+        __m256i a = _mm256_loadu_si256((const __m256i *) (data + pos));
+        __m256i b = _mm256_loadu_si256((const __m256i *) (data + pos + 1));
+        unsigned mask = (unsigned) _mm256_movemask_epi8(
+                _mm256_and_si256(_mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, second)));
+        if (mask != 0)
+            return pos + (size_t) __builtin_ctz(mask);
+    }
+    return pos + find_pair_scalar(scanner, data + pos, size - pos);
+}
+#endif
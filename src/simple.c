@@ -1,45 +1,1165 @@
+#define _GNU_SOURCE
+
 #include <simple.h>
+#include <archive.h>
+#include <input.h>
+#include <output.h>
+#include <matcher.h>
+#include <report.h>
+#include <journal.h>
+#include <slice.h>
+#include <uring.h>
+#include <pool.h>
+#include <ring.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <limits.h>
+#include <libgen.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/**
+ * Lines pg_dump of PostgreSQL 10 and newer writes which 9.6 can't restore.
+ * Data of COPY blocks is passed through unchanged without matching rules,
+ * COPY header is recognised at any length, its limit only bounds the carry.
+ */
+static const MatchRule FIX_RULES[] = {
+        {"AS integer", "    AS integer", MatchKind_Line, 0},
+        {"AS bigint", "    AS bigint", MatchKind_Line, 0},
+        {"AS smallint", "    AS smallint", MatchKind_Line, 0},
+        {"default_table_access_method", "SET default_table_access_method = heap;", MatchKind_Line, 0},
+        {"transaction_timeout", "SET transaction_timeout = 0;", MatchKind_Line, 0},
+        {"\\restrict", "\\restrict ", MatchKind_Prefix, 256},
+        {"\\unrestrict", "\\unrestrict ", MatchKind_Prefix, 256},
+        {"COPY", "COPY ", MatchKind_Copy, 4096},
+};
+
+#ifndef FIXPQ_WINDOW_SIZE
+#define FIXPQ_WINDOW_SIZE (1 << 20)
+#endif
+#if FIXPQ_WINDOW_SIZE < (1 << 16)
+#error "FIXPQ_WINDOW_SIZE must be larger than longest line rule can match"
+#endif
+
+// input is processed in windows this large, carry of at most one short line
+// is all that's added to it however long lines are
+static const size_t STREAM_BLOCK_SIZE = FIXPQ_WINDOW_SIZE;
+
+static const int PIPE_SIZE = 1 << 20;
+
+// blocks passed between stages of streamed input
+#define PIPE_DEPTH 4
+
+// input blocks in flight through io_uring
+#define URING_DEPTH 4
+
+// mapped input is scanned in parallel in chunks at least this large
+static const size_t CHUNK_SIZE = 1 << 24;
+
+// larger mapped input is converted in segments this large, each ending with checkpoint
+static const size_t CHECKPOINT_SIZE = 1 << 28;
+
+static short is_in_place(State *state, struct stat *in_stat);
+
+static void fix_mapped(State *state, const char *data, size_t size, struct stat *in_stat, short in_place);
+
+static void fix_streamed(State *state, Input *source, short in_place);
+
+static void fix_range(State *state, const char *data, size_t size, struct stat *in_stat);
+
+static size_t line_start(const char *data, size_t size, size_t pos);
+
+static void fix_journaled(State *state, const char *data, size_t size, struct stat *in_stat);
+
+static void fix_compacted(State *state, const char *data, size_t size, struct stat *in_stat);
+
+static short is_compacting(State *state, struct stat *in_stat);
+
+static void fix_archive(State *state, Input *source, struct stat *in_stat, short in_place);
+
+static PipeBlock *take_block(Pipeline *pipeline, Ring *ring, PipeStage stage);
+
+static short read_block_into(Pipeline *pipeline);
+
+static short scan_block(Pipeline *pipeline);
+
+static short write_block_out(Pipeline *pipeline);
+
+static void *run_reader(void *arg);
+
+static void *run_writer(void *arg);
+
+static unsigned backoff(unsigned spins);
+
+static short fix_uring(State *state, int in_fd, size_t size, struct stat *in_stat, short in_place);
+
+static size_t fix_block(State *state, Output *out, const char *buffer, size_t size, short at_eof, short *long_line,
+                        short *copy);
+
+static size_t queue_reads(State *state, Uring *ring, int in_fd, RingBlock *blocks, size_t next, size_t limit, size_t size);
+
+static void read_block(State *state, Uring *ring, int in_fd, RingBlock *blocks, size_t index, size_t size);
+
+static void reap_block(State *state, Uring *ring, int in_fd, RingBlock *blocks);
+
+static void write_block(State *state, Uring *ring, RingBlock *blocks, size_t index, off_t offset);
+
+static short is_regular_output(State *state);
+
+static size_t fix_lines(State *state, Output *out, const char *data, size_t size, short at_eof, short *copy);
+
+static void fix_windows(State *state, Output *out, const char *data, size_t size, short *copy);
+
+static void fix_chunks(State *state, Output *out, const char *data, size_t size, short *copy);
+
+static void scan_chunk(void *arg);
+
+static void init_matcher(State *state);
+
+static short next_fix(State *state, const char *data, size_t size, size_t from, short at_eof, short *copy,
+                      Match *match);
+
+static void report_fix(State *state, const char *data, Match *match);
+
+static void open_staged(State *state, struct stat *in_stat);
+
+static void commit_staged(State *state);
+
+static void discard_staged(State *state);
+
+static void grow_pipe(int fd);
+
+static void write_span(State *state, Output *out, const char *data, size_t len);
+
+static void flush_out(State *state, Output *out);
+
+static void finish_out(State *state, Output *out);
+
+static void fail_write(State *state);
+
+static void fail_journal(Journal *journal);
 
 void open_out(State *state) {
     if (!state->output) {
         return;
     }
+    if (strcmp(state->output, "-") == 0) {
+        state->out = stdout;
+        return;
+    }
     state->out = fopen(state->output, "w+");
     if (state->out == NULL) {
-        printf("Cannot open file to write: %s\n", state->output);
+        fprintf(stderr, "Cannot open file to write: %s\n", state->output);
         if (state->in) fclose(state->in);
         exit(1);
     }
 }
 
 void fix_content(State *state) {
-    char *buffer = (char *) malloc(2048);
-    size_t len = 2048;
-    FILE *tmp = tmpfile();
+    struct stat in_stat;
+    if (fstat(fileno(state->in), &in_stat) != 0) {
+        fprintf(stderr, "Cannot read file: %s\n", state->input);
+        exit(1);
+    }
+    short in_place = is_in_place(state, &in_stat);
+    init_matcher(state);
+
+    grow_pipe(fileno(state->in));
+    Input *source = Input_init(fileno(state->in));
+    if (source == NULL) {
+        fprintf(stderr, "Cannot read file: %s\n", state->input);
+        exit(1);
+    }
+    state->compressed = source->format != InputFormat_Plain;
+    if (source->format != InputFormat_Plain && in_place && state->compress == OutputFormat_Plain) {
+        // keep file compressed with the same codec
+        if (source->format == InputFormat_Gzip) state->compress = OutputFormat_Gzip;
+        else if (source->format == InputFormat_Zstd) state->compress = OutputFormat_Zstd;
+    }
+    if (source->format != InputFormat_Plain && in_place &&
+        (state->compress == OutputFormat_Plain || !Output_supports(state->compress))) {
+        fprintf(stderr, "Cannot rewrite compressed file in place, use -o: %s\n", state->input);
+        exit(1);
+    }
+
+    if (Archive_detect(source)) {
+        fix_archive(state, source, &in_stat, in_place);
+        Input_free(source);
+        return;
+    }
+
+    size_t size = (size_t) in_stat.st_size;
+    char *data = MAP_FAILED;
+    if (S_ISREG(in_stat.st_mode) && source->format == InputFormat_Plain && size > 0)
+        data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fileno(state->in), 0);
+
+    short journaled = !in_place && state->dry == 0 && state->compress == OutputFormat_Plain && !state->ranged &&
+                      is_regular_output(state) && (size > CHECKPOINT_SIZE || state->resume);
+    short compacted = in_place && data != MAP_FAILED && state->compress == OutputFormat_Plain &&
+                      (state->compact || state->resume);
+    if (in_place && data != MAP_FAILED && !compacted && is_compacting(state, &in_stat)) {
+        fprintf(stderr, "Fixing in place was interrupted, continue it with --resume: %s\n", state->output);
+        exit(1);
+    }
+    if (state->resume && (data == MAP_FAILED || (!journaled && !compacted))) {
+        fprintf(stderr, "Only plain file written to another plain file can be resumed: %s\n", state->input);
+        exit(1);
+    }
+
+    if (state->ranged && (data == MAP_FAILED || in_place || state->dry || state->compress != OutputFormat_Plain ||
+                          !is_regular_output(state))) {
+        fprintf(stderr, "Only plain file written to another plain file can be sliced: %s\n", state->input);
+        exit(1);
+    }
+
+    if (data != MAP_FAILED) {
+        madvise(data, size, MADV_SEQUENTIAL);
+        if (state->ranged) fix_range(state, data, size, &in_stat);
+        else if (compacted) fix_compacted(state, data, size, &in_stat);
+        else if (journaled) fix_journaled(state, data, size, &in_stat);
+        else fix_mapped(state, data, size, &in_stat, in_place);
+        munmap(data, size);
+    } else if (S_ISREG(in_stat.st_mode) && size == 0) {
+        if (state->dry == 0 && !in_place) {
+            open_out(state);
+            Output *out = Output_init(fileno(state->out), state->compress, state->jobs);
+            finish_out(state, out);
+            Output_free(out);
+        }
+    } else {
+        if (in_place) open_staged(state, &in_stat);
+        fix_streamed(state, source, in_place);
+    }
+    Input_free(source);
+}
+
+/**
+ * Rewrite over input file itself. Output is staged in sibling temporary file
+ * and renamed over input once complete, so input is never truncated. With
+ * `--compact` plain file is compacted within itself instead.
+ */
+static short is_in_place(State *state, struct stat *in_stat) {
+    if (state->dry || strcmp(state->output, "-") == 0)
+        return 0;
+
+    struct stat out_stat;
+    if (stat(state->output, &out_stat) != 0)
+        return 0;
+    return out_stat.st_dev == in_stat->st_dev && out_stat.st_ino == in_stat->st_ino;
+}
+
+/**
+ * Write mapped input as spans of unchanged bytes between removed lines.
+ * In-place file with nothing to fix is left untouched.
+ */
+static void fix_mapped(State *state, const char *data, size_t size, struct stat *in_stat, short in_place) {
+    if (state->report) Report_seek(state->report, data, 0);
+    size_t first = 0;
+    short copy = 0;
+    if (in_place) {
+        Match match;
+        if (!next_fix(state, data, size, 0, 1, &copy, &match))
+            return;
+        first = match.start;
+    }
+    short parallel = state->jobs > 1 && size - first > CHUNK_SIZE;
+    if (!parallel && state->dry == 0 && state->compress == OutputFormat_Plain && is_regular_output(state) &&
+        fix_uring(state, fileno(state->in), size, in_stat, in_place))
+        return;
+    if (in_place) open_staged(state, in_stat);
+
+    Output *out = NULL;
+    if (state->dry == 0) {
+        if (!in_place) open_out(state);
+        out = Output_init(fileno(state->out), state->compress, state->jobs);
+        Output_source(out, fileno(state->in), data, size);
+        write_span(state, out, data, first);
+    }
+
+    if (parallel) fix_chunks(state, out, data + first, size - first, &copy);
+    else fix_windows(state, out, data + first, size - first, &copy);
+    if (state->report) Report_move(state->report, data + size, NULL);
+
+    if (out) {
+        finish_out(state, out);
+        Output_free(out);
+    }
+    if (in_place) commit_staged(state);
+}
+
+/**
+ * Large input is converted in `CHECKPOINT_SIZE` segments cut at line ends,
+ * after each one output is synced and checkpoint recorded in journal.
+ * Resumed conversion continues after last checkpoint once output written
+ * up to it still hashes the same, journal is removed when done.
+ */
+static void fix_journaled(State *state, const char *data, size_t size, struct stat *in_stat) {
+    Journal *journal = Journal_init(state->output, in_stat);
+    size_t pos = 0;
+    short copy = 0;
+    if (state->resume && Journal_load(journal) == 0) {
+        int fd = open(state->output, O_RDWR);
+        if (fd < 0 || Journal_verify(journal, fd) != 0 || ftruncate(fd, (off_t) journal->outOffset) != 0 ||
+            lseek(fd, (off_t) journal->outOffset, SEEK_SET) < 0) {
+            fprintf(stderr, "Output doesn't match journal, cannot resume: %s\n", state->output);
+            exit(1);
+        }
+        state->out = fdopen(fd, "w");
+        pos = journal->inOffset;
+        copy = journal->copy;
+        fprintf(stderr, "Resuming at byte %zu of input\n", pos);
+    } else {
+        open_out(state);
+    }
+    state->journal = journal;
+
+    Output *out = Output_init(fileno(state->out), OutputFormat_Plain, 0);
+    Output_source(out, fileno(state->in), data, size);
+    const size_t base = journal->outOffset;
+    while (pos < size) {
+        size_t end = size;
+        if (size - pos > CHECKPOINT_SIZE) {
+            const char *nl = memchr(data + pos + CHECKPOINT_SIZE, '\n', size - pos - CHECKPOINT_SIZE);
+            end = nl ? (size_t) (nl - data) + 1 : size;
+        }
+        if (state->jobs > 1 && end - pos > CHUNK_SIZE) fix_chunks(state, out, data + pos, end - pos, &copy);
+        else fix_windows(state, out, data + pos, end - pos, &copy);
+        flush_out(state, out);
+
+        pos = end;
+        if (pos < size && Journal_save(journal, out->fd, pos, base + out->written, copy) != 0)
+            fail_journal(journal);
+    }
+
+    finish_out(state, out);
+    Output_free(out);
+    state->journal = NULL;
+    Journal_free(journal, 1);
+}
+
+/**
+ * Convert only lines starting within `--range`, both of its ends are moved
+ * forward to line start so slices of adjacent ranges meet exactly. Whether
+ * the first line is inside COPY data is guessed from lines following it,
+ * merge converts the slice again when the previous one ended otherwise.
+ */
+static void fix_range(State *state, const char *data, size_t size, struct stat *in_stat) {
+    size_t stop = state->rangeStart < size && state->rangeLen < size - state->rangeStart
+                  ? state->rangeStart + state->rangeLen : size;
+    size_t begin = line_start(data, size, state->rangeStart);
+    size_t end = line_start(data, size, stop);
+
+    Slice *slice = Slice_init(state->output, state->input, in_stat);
+    slice->begin = begin;
+    slice->end = end;
+    slice->copyBegin = Matcher_copy_at(state->matcher, data, size, begin);
+
+    open_out(state);
+    Output *out = Output_init(fileno(state->out), OutputFormat_Plain, 0);
+    Output_source(out, fileno(state->in), data, size);
+    slice->copyEnd = fix_slice(state, out, data, begin, end, slice->copyBegin);
+    finish_out(state, out);
+    slice->outSize = out->written;
+    Output_free(out);
+
+    if (Slice_save(slice) != 0) {
+        fprintf(stderr, "Cannot write to file: %s\n", slice->path);
+        exit(1);
+    }
+    fprintf(stderr, "Slice: bytes %zu to %zu of input\n", begin, end);
+    Slice_free(slice);
+}
+
+/**
+ * Write lines of mapped input from `begin` to `end` starting with given
+ * COPY state, returns COPY state at `end`.
+ */
+short fix_slice(State *state, Output *out, const char *data, size_t begin, size_t end, short copy) {
+    init_matcher(state);
+    if (state->jobs > 1 && end - begin > CHUNK_SIZE) fix_chunks(state, out, data + begin, end - begin, &copy);
+    else fix_windows(state, out, data + begin, end - begin, &copy);
+    flush_out(state, out);
+    return copy;
+}
+
+/**
+ * First line start at or after `pos`.
+ */
+static size_t line_start(const char *data, size_t size, size_t pos) {
+    if (pos >= size)
+        return size;
+    if (pos == 0 || data[pos - 1] == '\n')
+        return pos;
+    const char *nl = memchr(data + pos, '\n', size - pos);
+    return nl ? (size_t) (nl - data) + 1 : size;
+}
+
+/**
+ * Plain file fixed in place is compacted forward without a second copy: each
+ * block read at read cursor is written at write cursor trailing behind it and
+ * file is truncated once done. Checkpoint is saved in journal before a write
+ * could reach input past the previous one, together with input of the block
+ * when the write overlaps it, so interrupted compaction is continued with
+ * `--resume`. Memory and journal stay within two blocks.
+ */
+static void fix_compacted(State *state, const char *data, size_t size, struct stat *in_stat) {
+    Journal *journal = Journal_init(state->output, in_stat);
+    journal->backupCap = STREAM_BLOCK_SIZE;
+    int fd = open(state->output, O_RDWR);
+    if (fd < 0)
+        fail_write(state);
+
+    size_t pos, end;
+    short copy = 0;
+    short long_line = 0;
+    if (Journal_load_shift(journal) == 0) {
+        if (!state->resume) {
+            fprintf(stderr, "Fixing in place was interrupted, continue it with --resume: %s\n", state->output);
+            exit(1);
+        }
+        if (journal->backupLen > 0 && (pwrite(fd, journal->backup, journal->backupLen,
+                                              (off_t) journal->inOffset) != (ssize_t) journal->backupLen ||
+                                       fdatasync(fd) != 0))
+            fail_write(state);
+        size = journal->inSize;
+        pos = journal->inOffset;
+        end = journal->outOffset;
+        copy = journal->copy;
+        long_line = journal->longLine;
+        fprintf(stderr, "Resuming at byte %zu of input\n", pos);
+    } else {
+        Match match;
+        if (!next_fix(state, data, size, 0, 1, &copy, &match)) {
+            close(fd);
+            Journal_free(journal, 0);
+            return;
+        }
+        pos = end = match.start;
+        copy = 0;
+    }
+
+    char *buffer = (char *) malloc(STREAM_BLOCK_SIZE);
+    Output *out = Output_init(fd, OutputFormat_Plain, 0);
+    // input from here on is intact, writes stay before it until next checkpoint
+    size_t saved = pos;
+    while (pos < size) {
+        size_t len = size - pos > STREAM_BLOCK_SIZE ? STREAM_BLOCK_SIZE : size - pos;
+        if (pread(fd, buffer, len, (off_t) pos) != (ssize_t) len) {
+            fprintf(stderr, "Cannot read file: %s\n", state->input);
+            exit(1);
+        }
+        short block_copy = copy;
+        short block_long_line = long_line;
+        size_t written = out->written;
+        size_t tail = fix_block(state, out, buffer, len, pos + len == size, &long_line, &copy);
+        size_t kept = out->written - written;
+
+        if (end + kept > saved) {
+            const char *backup = end + kept > pos ? buffer : NULL;
+            if (fdatasync(fd) != 0 || Journal_save_shift(journal, pos, end, block_copy, block_long_line, backup,
+                                                         backup ? tail : 0) != 0)
+                fail_journal(journal);
+            saved = pos;
+        }
+        if (lseek(fd, (off_t) end, SEEK_SET) < 0)
+            fail_write(state);
+        flush_out(state, out);
+        pos += tail;
+        end += kept;
+    }
+
+    if (fdatasync(fd) != 0 || Journal_save_shift(journal, size, end, copy, long_line, NULL, 0) != 0)
+        fail_journal(journal);
+    if (ftruncate(fd, (off_t) end) != 0 || fdatasync(fd) != 0)
+        fail_write(state);
+    Output_free(out);
+    free(buffer);
+    close(fd);
+    Journal_free(journal, 1);
+}
+
+/**
+ * Interrupted compaction leaves journal behind, file is half shifted then.
+ */
+static short is_compacting(State *state, struct stat *in_stat) {
+    Journal *journal = Journal_init(state->output, in_stat);
+    journal->backupCap = STREAM_BLOCK_SIZE;
+    short found = Journal_load_shift(journal) == 0;
+    Journal_free(journal, 0);
+    return found;
+}
+
+/**
+ * Single pass over pipe, compressed or other stream split into reading,
+ * scanning and writing stages passing `PIPE_DEPTH` blocks through rings, so
+ * slow input or output doesn't hold scanning back. Scanner keeps the last
+ * block until the next one arrives to copy its short trailing line in front
+ * of it, memory stays at `PIPE_DEPTH` blocks no matter how long lines are.
+ * Reader and writer run on their own threads with more than one job,
+ * otherwise all stages take turns on the calling thread.
+ */
+static void fix_streamed(State *state, Input *source, short in_place) {
+    Pipeline pipeline;
+    memset(&pipeline, 0, sizeof(Pipeline));
+    pipeline.state = state;
+    pipeline.source = source;
+    pipeline.carryCap = state->matcher->maxLine + 1;
+    pipeline.blockLen = PIPE_DEPTH;
+    pipeline.blocks = (PipeBlock *) malloc(sizeof(PipeBlock) * pipeline.blockLen);
+    memset(pipeline.blocks, 0, sizeof(PipeBlock) * pipeline.blockLen);
+    pipeline.empty = Ring_init(pipeline.blockLen);
+    pipeline.filled = Ring_init(pipeline.blockLen);
+    pipeline.scanned = Ring_init(pipeline.blockLen);
+
+    if (state->dry == 0) {
+        if (!in_place) open_out(state);
+        pipeline.out = Output_init(fileno(state->out), state->compress, state->jobs);
+        grow_pipe(pipeline.out->fd);
+    }
+    for (size_t i = 0; i < pipeline.blockLen; i++) {
+        pipeline.blocks[i].data = (char *) malloc(pipeline.carryCap + STREAM_BLOCK_SIZE);
+        if (pipeline.out) pipeline.blocks[i].spans = Output_init(-1, OutputFormat_Plain, 0);
+        Ring_push(pipeline.empty, &pipeline.blocks[i]);
+    }
+
+    if (state->jobs > 1) {
+        pthread_t reader, writer;
+        pthread_create(&reader, NULL, run_reader, &pipeline);
+        pthread_create(&writer, NULL, run_writer, &pipeline);
+        for (unsigned spins = 0; !pipeline.done[PipeStage_Scan];)
+            spins = scan_block(&pipeline) ? 0 : backoff(spins);
+        pthread_join(reader, NULL);
+        pthread_join(writer, NULL);
+    } else {
+        while (!pipeline.done[PipeStage_Write]) {
+            if (!pipeline.done[PipeStage_Read]) read_block_into(&pipeline);
+            if (!pipeline.done[PipeStage_Scan]) scan_block(&pipeline);
+            write_block_out(&pipeline);
+        }
+    }
+    if (state->stats)
+        fprintf(stderr, "Stalls: reader %zu, scanner %zu, writer %zu\n", pipeline.stalls[PipeStage_Read],
+                pipeline.stalls[PipeStage_Scan], pipeline.stalls[PipeStage_Write]);
+
+    if (pipeline.out) finish_out(state, pipeline.out);
+    Output_free(pipeline.out);
+    for (size_t i = 0; i < pipeline.blockLen; i++) {
+        free(pipeline.blocks[i].data);
+        Output_free(pipeline.blocks[i].spans);
+    }
+    free(pipeline.blocks);
+    Ring_free(pipeline.empty);
+    Ring_free(pipeline.filled);
+    Ring_free(pipeline.scanned);
 
-    while (!feof(state->in) && !ferror(state->in)) {
-        size_t read_size = getline(&buffer, &len, state->in);
-        // printf(" >> %s", buffer);
-        if (read_size == -1)
-            break;
-        if (strcmp(buffer, "    AS integer") == 0) {
-            printf("Found 'AS integer' in line '%s'", buffer);
-        } else {
-            fwrite(buffer, sizeof(*buffer), read_size, tmp);
+    if (in_place && state->fixed > 0)
+        commit_staged(state);
+    else if (in_place)
+        discard_staged(state);
+}
+
+/**
+ * Take block from `ring` for `stage`, counts a stall once per wait.
+ */
+static PipeBlock *take_block(Pipeline *pipeline, Ring *ring, PipeStage stage) {
+    void *block;
+    if (Ring_pop(ring, &block)) {
+        pipeline->waiting[stage] = 0;
+        return (PipeBlock *) block;
+    }
+    if (!pipeline->waiting[stage]) pipeline->stalls[stage] += 1;
+    pipeline->waiting[stage] = 1;
+    return NULL;
+}
+
+/**
+ * Reading stage, fills free block after the room left for carried line.
+ */
+static short read_block_into(Pipeline *pipeline) {
+    PipeBlock *block = take_block(pipeline, pipeline->empty, PipeStage_Read);
+    if (block == NULL)
+        return 0;
+    ssize_t read_size = Input_read(pipeline->source, block->data + pipeline->carryCap, STREAM_BLOCK_SIZE);
+    if (read_size < 0) {
+        fprintf(stderr, "Cannot read file: %s\n", pipeline->state->input);
+        exit(1);
+    }
+    block->len = (size_t) read_size;
+    block->eof = read_size == 0;
+    pipeline->done[PipeStage_Read] = block->eof;
+    Ring_push(pipeline->filled, block);
+    return 1;
+}
+
+/**
+ * Scanning stage, only spans to write are collected, held block is handed
+ * to writer once its trailing line is copied in front of the next one.
+ */
+static short scan_block(Pipeline *pipeline) {
+    State *state = pipeline->state;
+    PipeBlock *block = take_block(pipeline, pipeline->filled, PipeStage_Scan);
+    if (block == NULL)
+        return 0;
+
+    block->buffer = block->data + pipeline->carryCap - pipeline->carry;
+    block->size = pipeline->carry + block->len;
+    if (pipeline->held) {
+        memcpy(block->buffer, pipeline->held->buffer + pipeline->held->tail, pipeline->carry);
+        if (state->report) Report_move(state->report, pipeline->held->buffer + pipeline->held->tail, block->buffer);
+        Ring_push(pipeline->scanned, pipeline->held);
+    } else if (state->report) {
+        Report_seek(state->report, block->buffer, 0);
+    }
+
+    block->tail = fix_block(state, block->spans, block->buffer, block->size, block->eof, &pipeline->longLine,
+                            &pipeline->copy);
+    pipeline->carry = block->size - block->tail;
+    pipeline->held = block;
+    if (block->eof) {
+        if (state->report) Report_move(state->report, block->buffer + block->tail, NULL);
+        Ring_push(pipeline->scanned, block);
+        pipeline->held = NULL;
+        pipeline->done[PipeStage_Scan] = 1;
+    }
+    return 1;
+}
+
+/**
+ * Writing stage, spans collected by scanner are written in order and block
+ * goes back to reader.
+ */
+static short write_block_out(Pipeline *pipeline) {
+    PipeBlock *block = take_block(pipeline, pipeline->scanned, PipeStage_Write);
+    if (block == NULL)
+        return 0;
+    if (pipeline->out) {
+        for (size_t i = 0; i < block->spans->spanLen; i++)
+            write_span(pipeline->state, pipeline->out, block->spans->spans[i].iov_base, block->spans->spans[i].iov_len);
+        block->spans->spanLen = 0;
+        flush_out(pipeline->state, pipeline->out);
+    }
+    pipeline->done[PipeStage_Write] = block->eof;
+    Ring_push(pipeline->empty, block);
+    return 1;
+}
+
+static void *run_reader(void *arg) {
+    Pipeline *pipeline = (Pipeline *) arg;
+    for (unsigned spins = 0; !pipeline->done[PipeStage_Read];)
+        spins = read_block_into(pipeline) ? 0 : backoff(spins);
+    return NULL;
+}
+
+static void *run_writer(void *arg) {
+    Pipeline *pipeline = (Pipeline *) arg;
+    for (unsigned spins = 0; !pipeline->done[PipeStage_Write];)
+        spins = write_block_out(pipeline) ? 0 : backoff(spins);
+    return NULL;
+}
+
+/**
+ * Wait of stage thread with nothing to do, spins shortly, then yields, then sleeps.
+ */
+static unsigned backoff(unsigned spins) {
+    if (spins < 64) {
+        return spins + 1;
+    } else if (spins < 128) {
+        sched_yield();
+        return spins + 1;
+    }
+    struct timespec pause = {0, 50000};
+    nanosleep(&pause, NULL);
+    return spins;
+}
+
+/**
+ * Process one block starting with line carried from previous one. Returns
+ * offset of trailing line left to carry into the next block, trailing line too
+ * long to ever match is written right away and skipped up to its end.
+ */
+static size_t fix_block(State *state, Output *out, const char *buffer, size_t size, short at_eof, short *long_line,
+                        short *copy) {
+    size_t from = 0;
+    if (*long_line) {
+        const char *nl = memchr(buffer, '\n', size);
+        from = nl ? (size_t) (nl - buffer) + 1 : size;
+        if (out) write_span(state, out, buffer, from);
+        *long_line = nl == NULL;
+    }
+
+    size_t tail = from + fix_lines(state, out, buffer + from, size - from, at_eof, copy);
+    if (size - tail > state->matcher->maxLine) {
+        if (out) write_span(state, out, buffer + tail, size - tail);
+        tail = size;
+        *long_line = 1;
+    }
+    return tail;
+}
+
+/**
+ * Regular file is read `URING_DEPTH` blocks ahead through io_uring while
+ * earlier blocks are scanned, spans of each block are written asynchronously
+ * at their output offset and block buffer is read into again once written.
+ * Returns 0 without doing anything when io_uring is unavailable.
+ */
+static short fix_uring(State *state, int in_fd, size_t size, struct stat *in_stat, short in_place) {
+    Uring *ring = Uring_init(URING_DEPTH * 2);
+    if (ring == NULL)
+        return 0;
+    state->uring = 1;
+
+    if (in_place) open_staged(state, in_stat);
+    else open_out(state);
+    fflush(state->out);
+
+    const size_t carry_cap = state->matcher->maxLine + 1;
+    const size_t count = (size + STREAM_BLOCK_SIZE - 1) / STREAM_BLOCK_SIZE;
+    RingBlock blocks[URING_DEPTH];
+    memset(blocks, 0, sizeof(blocks));
+    for (size_t i = 0; i < URING_DEPTH; i++) {
+        blocks[i].data = (char *) malloc(carry_cap + STREAM_BLOCK_SIZE);
+        blocks[i].out = Output_init(fileno(state->out), OutputFormat_Plain, 0);
+    }
+
+    size_t next_read = queue_reads(state, ring, in_fd, blocks, 0, count < URING_DEPTH ? count : URING_DEPTH, size);
+    size_t carry = 0;
+    short long_line = 0;
+    short copy = 0;
+    off_t out_offset = 0;
+    for (size_t b = 0; b < count; b++) {
+        RingBlock *block = &blocks[b % URING_DEPTH];
+        char *buffer = block->data + carry_cap - carry;
+        while (block->reading) {
+            reap_block(state, ring, in_fd, blocks);
+            next_read = queue_reads(state, ring, in_fd, blocks, next_read, count < b + URING_DEPTH ? count : b + URING_DEPTH, size);
+        }
+
+        size_t block_size = carry + block->filled;
+        size_t tail = fix_block(state, block->out, buffer, block_size, b + 1 == count, &long_line, &copy);
+        carry = block_size - tail;
+        write_block(state, ring, blocks, b % URING_DEPTH, out_offset);
+        out_offset += (off_t) block->out->written;
+        block->out->written = 0;
+
+        if (b + 1 < count) {
+            // next block must own its buffer before carry is moved in front of it
+            while (next_read <= b + 1) {
+                while (blocks[next_read % URING_DEPTH].writing)
+                    reap_block(state, ring, in_fd, blocks);
+                read_block(state, ring, in_fd, blocks, next_read++, size);
+            }
+            memcpy(blocks[(b + 1) % URING_DEPTH].data + carry_cap - carry, buffer + tail, carry);
+        }
+        next_read = queue_reads(state, ring, in_fd, blocks, next_read, count < b + 1 + URING_DEPTH ? count : b + 1 + URING_DEPTH, size);
+    }
+
+    for (size_t i = 0; i < URING_DEPTH; i++) {
+        while (blocks[i].writing)
+            reap_block(state, ring, in_fd, blocks);
+        Output_free(blocks[i].out);
+        free(blocks[i].data);
+    }
+    Uring_free(ring);
+
+    if (lseek(fileno(state->out), out_offset, SEEK_SET) < 0)
+        fail_write(state);
+    if (in_place && state->fixed > 0)
+        commit_staged(state);
+    else if (in_place)
+        discard_staged(state);
+    return 1;
+}
+
+/**
+ * Read ahead into buffers of blocks already scanned and written, up to
+ * `limit` block. Returns index of the next block to read.
+ */
+static size_t queue_reads(State *state, Uring *ring, int in_fd, RingBlock *blocks, size_t next, size_t limit, size_t size) {
+    while (next < limit && !blocks[next % URING_DEPTH].writing)
+        read_block(state, ring, in_fd, blocks, next++, size);
+    return next;
+}
+
+static void read_block(State *state, Uring *ring, int in_fd, RingBlock *blocks, size_t index, size_t size) {
+    RingBlock *block = &blocks[index % URING_DEPTH];
+    const size_t carry_cap = state->matcher->maxLine + 1;
+    block->offset = (off_t) (index * STREAM_BLOCK_SIZE);
+    block->want = size - (size_t) block->offset < STREAM_BLOCK_SIZE ? size - (size_t) block->offset : STREAM_BLOCK_SIZE;
+    block->filled = 0;
+    block->reading = 1;
+    if (Uring_read(ring, in_fd, block->data + carry_cap, block->want, block->offset, (index % URING_DEPTH) * 2) != 0 ||
+        Uring_submit(ring) != 0) {
+        fprintf(stderr, "Cannot read file: %s\n", state->input);
+        exit(1);
+    }
+}
+
+/**
+ * Wait for one completion. Short read is continued, short write is
+ * finished with blocking write, both only happen on unusual file systems.
+ */
+static void reap_block(State *state, Uring *ring, int in_fd, RingBlock *blocks) {
+    const size_t carry_cap = state->matcher->maxLine + 1;
+    unsigned long tag;
+    int result;
+    if (Uring_wait(ring, &tag, &result) != 0)
+        fail_write(state);
+
+    RingBlock *block = &blocks[tag / 2];
+    if (tag % 2 == 0) {
+        if (result <= 0) {
+            fprintf(stderr, "Cannot read file: %s\n", state->input);
+            discard_staged(state);
+            exit(1);
+        }
+        block->filled += (size_t) result;
+        if (block->filled == block->want) {
+            block->reading = 0;
+            return;
+        }
+        if (Uring_read(ring, in_fd, block->data + carry_cap + block->filled, block->want - block->filled,
+                       block->offset + (off_t) block->filled, tag) != 0 || Uring_submit(ring) != 0)
+            fail_write(state);
+        return;
+    }
+
+    if (result < 0)
+        fail_write(state);
+    Output *out = block->out;
+    size_t skip = (size_t) result;
+    size_t i = 0;
+    while (i < out->spanLen && skip >= out->spans[i].iov_len)
+        skip -= out->spans[i++].iov_len;
+    if (i < out->spanLen) {
+        out->spans[i].iov_base = (char *) out->spans[i].iov_base + skip;
+        out->spans[i].iov_len -= skip;
+        off_t offset = block->offset + (off_t) result;
+        for (; i < out->spanLen; i++) {
+            if (pwrite(out->fd, out->spans[i].iov_base, out->spans[i].iov_len, offset) != (ssize_t) out->spans[i].iov_len)
+                fail_write(state);
+            offset += (off_t) out->spans[i].iov_len;
+        }
+    }
+    out->spanLen = 0;
+    block->writing = 0;
+}
+
+/**
+ * Queue collected spans of block at `offset` of output. Block with more spans
+ * than single writev takes is written blocking.
+ */
+static void write_block(State *state, Uring *ring, RingBlock *blocks, size_t index, off_t offset) {
+    RingBlock *block = &blocks[index];
+    Output *out = block->out;
+    if (out->spanLen == 0)
+        return;
+    if (out->spanLen > IOV_MAX) {
+        for (size_t i = 0; i < out->spanLen; i++) {
+            if (pwrite(out->fd, out->spans[i].iov_base, out->spans[i].iov_len, offset) != (ssize_t) out->spans[i].iov_len)
+                fail_write(state);
+            offset += (off_t) out->spans[i].iov_len;
         }
+        out->spanLen = 0;
+        return;
+    }
+    block->offset = offset;
+    block->writing = 1;
+    if (Uring_writev(ring, out->fd, out->spans, out->spanLen, offset, index * 2 + 1) != 0 || Uring_submit(ring) != 0)
+        fail_write(state);
+}
+
+/**
+ * Blocks are written at offsets, so only to a file fixpq opens itself.
+ * Redirected stdout may be appended to or already written.
+ */
+static short is_regular_output(State *state) {
+    struct stat out_stat;
+    if (strcmp(state->output, "-") == 0)
+        return 0;
+    return stat(state->output, &out_stat) != 0 || S_ISREG(out_stat.st_mode);
+}
+
+/**
+ * Custom format archive keeps SEQUENCE definitions in its TOC, only TOC is
+ * rewritten and data blocks following it are copied byte for byte.
+ */
+static void fix_archive(State *state, Input *source, struct stat *in_stat, short in_place) {
+    Archive *archive = Archive_init(source);
+    state->archive = 1;
+    if (Archive_rewrite(archive, state) != 0) {
+        fprintf(stderr, "Invalid or unsupported pg_dump archive: %s\n", state->input);
+        exit(1);
+    }
+    if (state->dry || (in_place && state->fixed == 0)) {
+        Archive_free(archive);
+        return;
     }
 
-    rewind(tmp);
-    if (state->dry == 0) open_out(state);
+    if (in_place) open_staged(state, in_stat);
+    else open_out(state);
+    Output *out = Output_init(fileno(state->out), state->compress, state->jobs);
+    write_span(state, out, archive->toc, archive->tocLen);
+    write_span(state, out, archive->buffer + archive->bufferPos, archive->bufferLen - archive->bufferPos);
+    flush_out(state, out);
 
-    while (!feof(tmp) && !ferror(tmp)) {
-        size_t read_size = getline(&buffer, &len, tmp);
-        if (read_size == -1)
-            break;
-        if (state->dry == 0)
-            fwrite(buffer, sizeof(*buffer), read_size, state->out);
+    char *buffer = (char *) malloc(STREAM_BLOCK_SIZE);
+    ssize_t read_size;
+    while ((read_size = Input_read(source, buffer, STREAM_BLOCK_SIZE)) > 0) {
+        write_span(state, out, buffer, (size_t) read_size);
+        flush_out(state, out);
+    }
+    if (read_size < 0) {
+        fprintf(stderr, "Cannot read file: %s\n", state->input);
+        discard_staged(state);
+        exit(1);
     }
 
-    fclose(tmp);
+    finish_out(state, out);
+    Output_free(out);
     free(buffer);
+    Archive_free(archive);
+    if (in_place) commit_staged(state);
+}
+
+/**
+ * Remove fixed lines from `len` bytes of `str` in place, returns new length.
+ * String starts `offset` bytes into input, lines are reported within it.
+ */
+size_t fix_string(State *state, char *str, size_t len, size_t offset) {
+    init_matcher(state);
+    if (state->report) Report_seek(state->report, str, offset);
+
+    Match match;
+    size_t kept = 0;
+    size_t span = 0;
+    short copy = 0;
+    while (next_fix(state, str, len, span, 1, &copy, &match)) {
+        report_fix(state, str, &match);
+        memmove(str + kept, str + span, match.start - span);
+        kept += match.start - span;
+        span = match.end;
+    }
+    memmove(str + kept, str + span, len - span);
+    if (state->report) Report_move(state->report, str + len, NULL);
+    return kept + len - span;
+}
+
+/**
+ * Write complete lines of `data` except fixed ones. Trailing line without
+ * newline is left to the caller unless `at_eof` is set, returns its offset.
+ * Lines are never split one by one, only neighbourhood of a match is looked at.
+ */
+static size_t fix_lines(State *state, Output *out, const char *data, size_t size, short at_eof, short *copy) {
+    Match match;
+    size_t span = 0;
+    while (next_fix(state, data, size, span, at_eof, copy, &match)) {
+        report_fix(state, data, &match);
+        if (out) write_span(state, out, data + span, match.start - span);
+        span = match.end;
+    }
+
+    size_t tail = size;
+    if (!at_eof) {
+        const char *nl = memrchr(data + span, '\n', size - span);
+        tail = nl ? (size_t) (nl - data) + 1 : span;
+    }
+    if (out) write_span(state, out, data + span, tail - span);
+    return tail;
+}
+
+/**
+ * Mapped input is walked in `STREAM_BLOCK_SIZE` windows the same way stream
+ * is read, only spans of one window are queued before they are written.
+ */
+static void fix_windows(State *state, Output *out, const char *data, size_t size, short *copy) {
+    short long_line = 0;
+    size_t pos = 0;
+    while (pos < size) {
+        size_t len = size - pos > STREAM_BLOCK_SIZE ? STREAM_BLOCK_SIZE : size - pos;
+        pos += fix_block(state, out, data + pos, len, pos + len == size, &long_line, copy);
+        if (out) flush_out(state, out);
+    }
+}
+
+/**
+ * Same as `fix_lines` for whole mapped input, chunks cut at line boundaries
+ * are scanned by `jobs` threads. Only matches are collected in parallel,
+ * they are reported and written in input order as chunks complete, at most
+ * twice as many chunks as threads are in flight. Chunk is scanned as if it
+ * started outside COPY data, once previous chunk turns out to end inside
+ * one matches before the first `\\.` line of the chunk are dropped.
+ */
+static void fix_chunks(State *state, Output *out, const char *data, size_t size, short *copy) {
+    const size_t window = state->jobs * 2;
+    FixChunk *chunks = (FixChunk *) malloc(sizeof(FixChunk) * window);
+    memset(chunks, 0, sizeof(FixChunk) * window);
+    Pool *pool = Pool_init(state->jobs);
+
+    size_t pos = 0;
+    size_t head = 0;
+    size_t in_flight = 0;
+    while (pos < size || in_flight > 0) {
+        while (pos < size && in_flight < window) {
+            FixChunk *chunk = &chunks[(head + in_flight) % window];
+            size_t end = size;
+            if (size - pos > CHUNK_SIZE) {
+                const char *nl = memchr(data + pos + CHUNK_SIZE, '\n', size - pos - CHUNK_SIZE);
+                end = nl ? (size_t) (nl - data) + 1 : size;
+            }
+            chunk->matcher = state->matcher;
+            chunk->data = data + pos;
+            chunk->size = end - pos;
+            chunk->matchLen = 0;
+            chunk->task.run = scan_chunk;
+            chunk->task.arg = chunk;
+            Pool_submit(pool, &chunk->task);
+            in_flight += 1;
+            pos = end;
+        }
+
+        FixChunk *chunk = &chunks[head];
+        Pool_wait(pool, &chunk->task);
+        size_t span = 0;
+        for (size_t i = 0; i < chunk->matchLen; i++) {
+            if (*copy && (!chunk->copyFound || chunk->matches[i].start < chunk->copyEnd))
+                continue;
+            report_fix(state, chunk->data, &chunk->matches[i]);
+            if (out) write_span(state, out, chunk->data + span, chunk->matches[i].start - span);
+            span = chunk->matches[i].end;
+        }
+        if (out) {
+            write_span(state, out, chunk->data + span, chunk->size - span);
+            flush_out(state, out);
+        }
+        if (!*copy || chunk->copyFound)
+            *copy = chunk->copy;
+        head = (head + 1) % window;
+        in_flight -= 1;
+    }
+
+    Pool_free(pool);
+    for (size_t i = 0; i < window; i++)
+        free(chunks[i].matches);
+    free(chunks);
+}
+
+static void scan_chunk(void *arg) {
+    FixChunk *chunk = (FixChunk *) arg;
+    size_t from = 0;
+    Match match;
+    chunk->copy = 0;
+    chunk->copyFound = Matcher_copy_end(chunk->matcher, chunk->data, chunk->size, 0, 1, &chunk->copyEnd);
+    while (Matcher_next(chunk->matcher, chunk->data, chunk->size, from, 1, &chunk->copy, &match)) {
+        if (chunk->matchLen == chunk->matchCap) {
+            chunk->matchCap = chunk->matchCap ? chunk->matchCap * 2 : 64;
+            chunk->matches = (Match *) realloc(chunk->matches, sizeof(Match) * chunk->matchCap);
+        }
+        chunk->matches[chunk->matchLen++] = match;
+        from = match.end;
+    }
+}
+
+/**
+ * Rules are compiled once and shared by every file of the run.
+ */
+static void init_matcher(State *state) {
+    if (state->matcher == NULL)
+        state->matcher = Matcher_init(FIX_RULES, sizeof(FIX_RULES) / sizeof(FIX_RULES[0]));
+}
+
+static short next_fix(State *state, const char *data, size_t size, size_t from, short at_eof, short *copy,
+                      Match *match) {
+    return Matcher_next(state->matcher, data, size, from, at_eof, copy, match);
+}
+
+/**
+ * Dry run only collects match for the final report.
+ */
+static void report_fix(State *state, const char *data, Match *match) {
+    state->fixed += 1;
+    if (state->report) {
+        Report_add(state->report, match->rule, data + match->start);
+        return;
+    }
+    fprintf(stderr, "Found '%s' in line '%.*s'\n", FIX_RULES[match->rule].name, (int) match->len,
+            data + match->start);
+}
+
+static void open_staged(State *state, struct stat *in_stat) {
+    size_t len = strlen(state->output) + strlen(".XXXXXX") + 1;
+    state->staged = (char *) malloc(len);
+    snprintf(state->staged, len, "%s.XXXXXX", state->output);
+
+    int fd = mkstemp(state->staged);
+    if (fd < 0) {
+        fprintf(stderr, "Cannot open file to write: %s\n", state->staged);
+        exit(1);
+    }
+    fchmod(fd, in_stat->st_mode & 07777);
+    if (fchown(fd, in_stat->st_uid, in_stat->st_gid) != 0) {
+        // not allowed to preserve owner, file stays ours
+    }
+    state->out = fdopen(fd, "w");
+}
+
+/**
+ * Make staged output durable and atomically replace target with it.
+ */
+static void commit_staged(State *state) {
+    if (fflush(state->out) != 0 || fsync(fileno(state->out)) != 0)
+        fail_write(state);
+    if (rename(state->staged, state->output) != 0)
+        fail_write(state);
+
+    char *path = strdup(state->output);
+    int dir = open(dirname(path), O_RDONLY | O_DIRECTORY);
+    if (dir >= 0) {
+        fsync(dir);
+        close(dir);
+    }
+    free(path);
+    free(state->staged);
+    state->staged = NULL;
+}
+
+static void discard_staged(State *state) {
+    if (state->staged == NULL)
+        return;
+    unlink(state->staged);
+    free(state->staged);
+    state->staged = NULL;
+}
+
+static void grow_pipe(int fd) {
+    struct stat fd_stat;
+    if (fstat(fd, &fd_stat) == 0 && S_ISFIFO(fd_stat.st_mode))
+        fcntl(fd, F_SETPIPE_SZ, PIPE_SIZE);
+}
+
+static void write_span(State *state, Output *out, const char *data, size_t len) {
+    if (state->journal) Journal_hash(state->journal, data, len);
+    if (Output_write(out, data, len) != 0)
+        fail_write(state);
+}
+
+static void flush_out(State *state, Output *out) {
+    if (Output_flush(out) != 0)
+        fail_write(state);
+}
+
+static void finish_out(State *state, Output *out) {
+    if (Output_finish(out) != 0)
+        fail_write(state);
+}
+
+static void fail_write(State *state) {
+    fprintf(stderr, "Cannot write to file: %s\n", state->output);
+    discard_staged(state);
+    exit(1);
+}
+
+static void fail_journal(Journal *journal) {
+    fprintf(stderr, "Cannot write to file: %s\n", journal->path);
+    exit(1);
 }
@@ -0,0 +1,214 @@
+#include <slice.h>
+#include <simple.h>
+#include <output.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+/**
+ * Output of `--range` slice is described by `<output>.manifest` naming input
+ * it was cut from, input bytes it covers and whether they start and end
+ * inside COPY data. Merge checks slices tile the whole input before
+ * concatenating them, slice which guessed its starting COPY state wrong is
+ * converted again from input.
+ */
+
+static const char *MANIFEST_SUFFIX = ".manifest";
+
+static const char *MANIFEST_FORMAT = "fixpq-slice 1\n"
+                                     "input_size %" SCNu64 "\n"
+                                     "input_mtime %" SCNu64 ".%" SCNu64 "\n"
+                                     "begin %" SCNu64 "\n"
+                                     "end %" SCNu64 "\n"
+                                     "copy_begin %hd\n"
+                                     "copy_end %hd\n"
+                                     "output_size %" SCNu64 "\n"
+                                     "input ";
+
+static void copy_slice(State *state, Output *out, Slice *slice);
+
+static short convert_slice(State *state, Output *out, Slice *slice, short copy);
+
+static int compare_begin(const void *left, const void *right);
+
+static void fail_merge(const char *message, const char *path);
+
+Slice *Slice_init(const char *output, const char *input, struct stat *in_stat) {
+    Slice *slice = (Slice *) malloc(sizeof(Slice));
+    memset(slice, 0, sizeof(Slice));
+    size_t len = strlen(output) + strlen(MANIFEST_SUFFIX) + 1;
+    slice->path = (char *) malloc(len);
+    snprintf(slice->path, len, "%s%s", output, MANIFEST_SUFFIX);
+    if (input) {
+        slice->input = realpath(input, NULL);
+        if (slice->input == NULL) slice->input = strdup(input);
+    }
+    if (in_stat) {
+        slice->inSize = (uint64_t) in_stat->st_size;
+        slice->inMtimeSec = (uint64_t) in_stat->st_mtim.tv_sec;
+        slice->inMtimeNsec = (uint64_t) in_stat->st_mtim.tv_nsec;
+    }
+    return slice;
+}
+
+void Slice_free(Slice *slice) {
+    if (slice == NULL)
+        return;
+    free(slice->path);
+    free(slice->input);
+    free(slice);
+}
+
+int Slice_save(Slice *slice) {
+    FILE *file = fopen(slice->path, "w");
+    if (file == NULL)
+        return -1;
+    fprintf(file, "fixpq-slice 1\ninput_size %" PRIu64 "\ninput_mtime %" PRIu64 ".%09" PRIu64 "\n", slice->inSize,
+            slice->inMtimeSec, slice->inMtimeNsec);
+    fprintf(file, "begin %" PRIu64 "\nend %" PRIu64 "\ncopy_begin %hd\ncopy_end %hd\noutput_size %" PRIu64 "\n",
+            slice->begin, slice->end, slice->copyBegin, slice->copyEnd, slice->outSize);
+    fprintf(file, "input %s\n", slice->input);
+    return fclose(file) == 0 ? 0 : -1;
+}
+
+/**
+ * Read manifest of slice written to `output`, NULL when it's missing or damaged.
+ */
+Slice *Slice_load(const char *output) {
+    Slice *slice = Slice_init(output, NULL, NULL);
+    FILE *file = fopen(slice->path, "r");
+    if (file == NULL) {
+        Slice_free(slice);
+        return NULL;
+    }
+    int fields = fscanf(file, MANIFEST_FORMAT, &slice->inSize, &slice->inMtimeSec, &slice->inMtimeNsec,
+                        &slice->begin, &slice->end, &slice->copyBegin, &slice->copyEnd, &slice->outSize);
+    size_t cap = 0;
+    ssize_t len = fields == 8 ? getline(&slice->input, &cap, file) : -1;
+    fclose(file);
+    if (len <= 1 || slice->input[len - 1] != '\n' || slice->begin > slice->end || slice->end > slice->inSize) {
+        Slice_free(slice);
+        return NULL;
+    }
+    slice->input[len - 1] = '\0';
+    return slice;
+}
+
+/**
+ * Concatenate outputs of slices named in `parts` into `output` in input
+ * order, result is the same as if whole input was converted at once.
+ */
+void merge_slices(State *state) {
+    if (state->partLen == 0 || state->output == NULL) {
+        fprintf(stderr, "Usage: fixpq merge -o file part...\n");
+        exit(1);
+    }
+    Slice **slices = (Slice **) malloc(sizeof(Slice *) * state->partLen);
+    for (size_t i = 0; i < state->partLen; i++) {
+        slices[i] = Slice_load(state->parts[i]);
+        if (slices[i] == NULL)
+            fail_merge("Cannot read slice manifest", state->parts[i]);
+        // slice is followed by its output from now on
+        free(slices[i]->path);
+        slices[i]->path = state->parts[i];
+    }
+    qsort(slices, state->partLen, sizeof(Slice *), compare_begin);
+
+    for (size_t i = 0; i < state->partLen; i++) {
+        const Slice *slice = slices[i];
+        const Slice *prev = i > 0 ? slices[i - 1] : NULL;
+        if (prev && (slice->inSize != prev->inSize || slice->inMtimeSec != prev->inMtimeSec ||
+                     slice->inMtimeNsec != prev->inMtimeNsec || strcmp(slice->input, prev->input) != 0))
+            fail_merge("Slice was cut from different input", slice->path);
+        if (prev == NULL && slice->begin != 0)
+            fail_merge("First slice doesn't start at beginning of input", slice->path);
+        if (prev && slice->begin != prev->end)
+            fail_merge("Slice doesn't continue where previous one ended", slice->path);
+    }
+    if (slices[state->partLen - 1]->end != slices[state->partLen - 1]->inSize)
+        fail_merge("Last slice doesn't reach end of input", slices[state->partLen - 1]->path);
+
+    state->out = strcmp(state->output, "-") == 0 ? stdout : fopen(state->output, "w");
+    if (state->out == NULL)
+        fail_merge("Cannot write to file", state->output);
+    Output *out = Output_init(fileno(state->out), OutputFormat_Plain, 0);
+    short copy = 0;
+    for (size_t i = 0; i < state->partLen; i++) {
+        if (slices[i]->copyBegin == copy) {
+            copy_slice(state, out, slices[i]);
+            copy = slices[i]->copyEnd;
+        } else {
+            copy = convert_slice(state, out, slices[i], copy);
+        }
+    }
+    if (Output_finish(out) != 0 || fflush(state->out) != 0)
+        fail_merge("Cannot write to file", state->output);
+    Output_free(out);
+    if (state->out != stdout) fclose(state->out);
+    state->out = NULL;
+
+    for (size_t i = 0; i < state->partLen; i++) {
+        slices[i]->path = NULL;
+        Slice_free(slices[i]);
+    }
+    free(slices);
+}
+
+static void copy_slice(State *state, Output *out, Slice *slice) {
+    int fd = open(slice->path, O_RDONLY);
+    struct stat part_stat;
+    if (fd < 0 || fstat(fd, &part_stat) != 0 || (uint64_t) part_stat.st_size != slice->outSize)
+        fail_merge("Slice output is missing or incomplete", slice->path);
+    if (part_stat.st_size > 0) {
+        char *data = mmap(NULL, (size_t) part_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED)
+            fail_merge("Cannot read file", slice->path);
+        Output_source(out, fd, data, (size_t) part_stat.st_size);
+        if (Output_write(out, data, (size_t) part_stat.st_size) != 0 || Output_flush(out) != 0)
+            fail_merge("Cannot write to file", state->output);
+        munmap(data, (size_t) part_stat.st_size);
+    }
+    close(fd);
+}
+
+/**
+ * Slice started on the wrong side of COPY data boundary, its input bytes
+ * are converted again starting with state previous slice ended in.
+ */
+static short convert_slice(State *state, Output *out, Slice *slice, short copy) {
+    fprintf(stderr, "Slice guessed COPY state wrong, converting it again: %s\n", slice->path);
+    int fd = open(slice->input, O_RDONLY);
+    struct stat in_stat;
+    if (fd < 0 || fstat(fd, &in_stat) != 0 || (uint64_t) in_stat.st_size != slice->inSize ||
+        (uint64_t) in_stat.st_mtim.tv_sec != slice->inMtimeSec ||
+        (uint64_t) in_stat.st_mtim.tv_nsec != slice->inMtimeNsec)
+        fail_merge("Input of slice is missing or changed", slice->input);
+    if (slice->end == slice->begin) {
+        close(fd);
+        return copy;
+    }
+
+    char *data = mmap(NULL, (size_t) slice->inSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED)
+        fail_merge("Cannot read file", slice->input);
+    Output_source(out, fd, data, (size_t) slice->inSize);
+    copy = fix_slice(state, out, data, (size_t) slice->begin, (size_t) slice->end, copy);
+    munmap(data, (size_t) slice->inSize);
+    close(fd);
+    return copy;
+}
+
+static int compare_begin(const void *left, const void *right) {
+    const Slice *a = *(const Slice **) left;
+    const Slice *b = *(const Slice **) right;
+    if (a->begin != b->begin)
+        return a->begin > b->begin ? 1 : -1;
+    return (a->end > b->end) - (a->end < b->end);
+}
+
+static void fail_merge(const char *message, const char *path) {
+    fprintf(stderr, "%s: %s\n", message, path);
+    exit(1);
+}
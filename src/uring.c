@@ -0,0 +1,197 @@
+#include <uring.h>
+#include <errno.h>
+#include <unistd.h>
+
+#ifdef FIXPQ_WITH_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+static void *queue_entry(Uring *ring);
+
+static short supports_ops(int fd);
+#endif
+
+/**
+ * Minimal io_uring wrapper on raw system calls. Returns NULL when kernel
+ * doesn't support io_uring or the operations used here, it's forbidden or
+ * fixpq was built without it, callers fall back to blocking I/O then.
+ */
+Uring *Uring_init(unsigned entries) {
+#ifdef FIXPQ_WITH_URING
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    int fd = (int) syscall(__NR_io_uring_setup, entries, &params);
+    if (fd < 0)
+        return NULL;
+    if (!(params.features & IORING_FEAT_SINGLE_MMAP) || !supports_ops(fd)) {
+        close(fd);
+        return NULL;
+    }
+
+    Uring *ring = (Uring *) malloc(sizeof(Uring));
+    memset(ring, 0, sizeof(Uring));
+    ring->fd = fd;
+    ring->entries = params.sq_entries;
+
+    size_t sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    size_t cq_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    ring->ringSize = sq_size > cq_size ? sq_size : cq_size;
+    ring->ring = mmap(NULL, ring->ringSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    ring->entrySize = params.sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqes = mmap(NULL, ring->entrySize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if (ring->ring == MAP_FAILED || ring->sqes == MAP_FAILED) {
+        if (ring->ring == MAP_FAILED) ring->ring = NULL;
+        if (ring->sqes == MAP_FAILED) ring->sqes = NULL;
+        Uring_free(ring);
+        return NULL;
+    }
+
+    char *base = (char *) ring->ring;
+    ring->sqHead = (unsigned *) (base + params.sq_off.head);
+    ring->sqTail = (unsigned *) (base + params.sq_off.tail);
+    ring->sqMask = (unsigned *) (base + params.sq_off.ring_mask);
+    ring->sqArray = (unsigned *) (base + params.sq_off.array);
+    ring->cqHead = (unsigned *) (base + params.cq_off.head);
+    ring->cqTail = (unsigned *) (base + params.cq_off.tail);
+    ring->cqMask = (unsigned *) (base + params.cq_off.ring_mask);
+    ring->cqes = base + params.cq_off.cqes;
+    return ring;
+#else
+    (void) entries;
+    return NULL;
+#endif
+}
+
+void Uring_free(Uring *ring) {
+    if (ring == NULL)
+        return;
+#ifdef FIXPQ_WITH_URING
+    if (ring->sqes) munmap(ring->sqes, ring->entrySize);
+    if (ring->ring) munmap(ring->ring, ring->ringSize);
+#endif
+    close(ring->fd);
+    free(ring);
+}
+
+/**
+ * Queue read of `len` bytes at `offset`, completion is reported with `tag`.
+ */
+int Uring_read(Uring *ring, int fd, void *buffer, size_t len, off_t offset, unsigned long tag) {
+#ifdef FIXPQ_WITH_URING
+    struct io_uring_sqe *sqe = (struct io_uring_sqe *) queue_entry(ring);
+    if (sqe == NULL)
+        return -1;
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = fd;
+    sqe->addr = (unsigned long) buffer;
+    sqe->len = (unsigned) len;
+    sqe->off = (unsigned long long) offset;
+    sqe->user_data = tag;
+    __atomic_store_n(ring->sqTail, *ring->sqTail + 1, __ATOMIC_RELEASE);
+    ring->queued += 1;
+    return 0;
+#else
+    return -1;
+#endif
+}
+
+/**
+ * Queue write of `len` spans at `offset`, spans must stay alive until completion.
+ */
+int Uring_writev(Uring *ring, int fd, const struct iovec *spans, size_t len, off_t offset, unsigned long tag) {
+#ifdef FIXPQ_WITH_URING
+    struct io_uring_sqe *sqe = (struct io_uring_sqe *) queue_entry(ring);
+    if (sqe == NULL)
+        return -1;
+    sqe->opcode = IORING_OP_WRITEV;
+    sqe->fd = fd;
+    sqe->addr = (unsigned long) spans;
+    sqe->len = (unsigned) len;
+    sqe->off = (unsigned long long) offset;
+    sqe->user_data = tag;
+    __atomic_store_n(ring->sqTail, *ring->sqTail + 1, __ATOMIC_RELEASE);
+    ring->queued += 1;
+    return 0;
+#else
+    return -1;
+#endif
+}
+
+/**
+ * Hand queued requests to kernel without waiting for them.
+ */
+int Uring_submit(Uring *ring) {
+#ifdef FIXPQ_WITH_URING
+    while (ring->queued > 0) {
+        int n = (int) syscall(__NR_io_uring_enter, ring->fd, ring->queued, 0, 0, NULL, 0);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n < 0)
+            return -1;
+        ring->queued -= (unsigned) n;
+    }
+#endif
+    return ring->queued == 0 ? 0 : -1;
+}
+
+/**
+ * Wait for next completion, `result` is what the system call would return
+ * or negative errno.
+ */
+int Uring_wait(Uring *ring, unsigned long *tag, int *result) {
+#ifdef FIXPQ_WITH_URING
+    if (Uring_submit(ring) != 0)
+        return -1;
+    for (;;) {
+        unsigned head = *ring->cqHead;
+        if (head != __atomic_load_n(ring->cqTail, __ATOMIC_ACQUIRE)) {
+            struct io_uring_cqe *cqe = (struct io_uring_cqe *) ring->cqes + (head & *ring->cqMask);
+            *tag = (unsigned long) cqe->user_data;
+            *result = cqe->res;
+            __atomic_store_n(ring->cqHead, head + 1, __ATOMIC_RELEASE);
+            return 0;
+        }
+        int n = (int) syscall(__NR_io_uring_enter, ring->fd, 0, 1, IORING_ENTER_GETEVENTS, NULL, 0);
+        if (n < 0 && errno != EINTR)
+            return -1;
+    }
+#else
+    (void) ring;
+    (void) tag;
+    (void) result;
+    return -1;
+#endif
+}
+
+#ifdef FIXPQ_WITH_URING
+static void *queue_entry(Uring *ring) {
+    unsigned tail = *ring->sqTail;
+    if (tail - __atomic_load_n(ring->sqHead, __ATOMIC_ACQUIRE) >= ring->entries)
+        return NULL;
+    unsigned index = tail & *ring->sqMask;
+    ring->sqArray[index] = index;
+    struct io_uring_sqe *sqe = (struct io_uring_sqe *) ring->sqes + index;
+    memset(sqe, 0, sizeof(struct io_uring_sqe));
+    return sqe;
+}
+
+/**
+ * Kernels before 5.6 set up rings but fail reads with -EINVAL, they don't
+ * know the probe either.
+ */
+static short supports_ops(int fd) {
+    const unsigned len = 256;
+    size_t probe_size = sizeof(struct io_uring_probe) + len * sizeof(struct io_uring_probe_op);
+    struct io_uring_probe *probe = (struct io_uring_probe *) malloc(probe_size);
+    memset(probe, 0, probe_size);
+    short supported = 0;
+    if (syscall(__NR_io_uring_register, fd, IORING_REGISTER_PROBE, probe, len) >= 0) {
+        supported = IORING_OP_READ < probe->ops_len && IORING_OP_WRITEV < probe->ops_len &&
+                    (probe->ops[IORING_OP_READ].flags & IO_URING_OP_SUPPORTED) &&
+                    (probe->ops[IORING_OP_WRITEV].flags & IO_URING_OP_SUPPORTED);
+    }
+    free(probe);
+    return supported;
+}
+#endif
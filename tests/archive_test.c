@@ -0,0 +1,40 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmocka.h>
+#include <sys/stat.h>
+
+#include <types.h>
+#include <fixture.h>
+#include <archive_test.h>
+
+/**
+ * Only SEQUENCE definition in TOC loses its `AS integer`, data offsets of
+ * TOC entries move with it and data blocks follow byte for byte.
+ */
+void test_archive_custom_sequence(void **state) {
+    State *fix = Fixture_state("./examples/dump.custom", "./tmp/archive.custom");
+    Fixture_run(fix);
+    assert_true(fix->archive);
+    assert_int_equal(fix->fixed, 1);
+    Fixture_free(fix);
+
+    Fixture_assert_same("./tmp/archive.custom", "./examples/dump.fixed.custom");
+}
+
+void test_archive_custom_unchanged(void **state) {
+    struct stat before, after;
+    Fixture_copy("./examples/dump.fixed.custom", "./tmp/archive_unchanged.custom");
+    assert_int_equal(stat("./tmp/archive_unchanged.custom", &before), 0);
+
+    State *fix = Fixture_state("./tmp/archive_unchanged.custom", "./tmp/archive_unchanged.custom");
+    Fixture_run(fix);
+    assert_int_equal(fix->fixed, 0);
+    Fixture_free(fix);
+
+    assert_int_equal(stat("./tmp/archive_unchanged.custom", &after), 0);
+    assert_int_equal(after.st_ino, before.st_ino);
+    Fixture_assert_same("./tmp/archive_unchanged.custom", "./examples/dump.fixed.custom");
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+#include <types.h>
+
+void test_archive_custom_sequence(void **state);
+
+void test_archive_custom_unchanged(void **state);
@@ -0,0 +1,55 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmocka.h>
+#include <sys/stat.h>
+
+#include <types.h>
+#include <directory.h>
+#include <fixture.h>
+#include <directory_test.h>
+
+static const char *DATA_FILES[] = {"2.dat.gz", "3.dat.gz"};
+
+static void assert_same_entry(const char *dir, const char *expected_dir, const char *name);
+
+void test_directory_toc(void **state) {
+    State *fix = Fixture_state("./examples/dump.dir", "./tmp/directory.dir");
+    fix_directory(fix);
+    assert_int_equal(fix->fixed, 1);
+    Fixture_free(fix);
+
+    assert_same_entry("./tmp/directory.dir", "./examples/dump.fixed.dir", "toc.dat");
+    for (size_t i = 0; i < sizeof(DATA_FILES) / sizeof(DATA_FILES[0]); i++)
+        assert_same_entry("./tmp/directory.dir", "./examples/dump.dir", DATA_FILES[i]);
+}
+
+/**
+ * With `--link` data files are the very files of input dump.
+ */
+void test_directory_link(void **state) {
+    State *fix = Fixture_state("./examples/dump.dir", "./tmp/directory_link.dir");
+    fix->link = 1;
+    fix_directory(fix);
+    Fixture_free(fix);
+
+    assert_same_entry("./tmp/directory_link.dir", "./examples/dump.fixed.dir", "toc.dat");
+    for (size_t i = 0; i < sizeof(DATA_FILES) / sizeof(DATA_FILES[0]); i++) {
+        char path[256], expected[256];
+        struct stat path_stat, expected_stat;
+        snprintf(path, sizeof(path), "./tmp/directory_link.dir/%s", DATA_FILES[i]);
+        snprintf(expected, sizeof(expected), "./examples/dump.dir/%s", DATA_FILES[i]);
+        assert_int_equal(stat(path, &path_stat), 0);
+        assert_int_equal(stat(expected, &expected_stat), 0);
+        assert_int_equal(path_stat.st_ino, expected_stat.st_ino);
+    }
+}
+
+static void assert_same_entry(const char *dir, const char *expected_dir, const char *name) {
+    char path[256], expected[256];
+    snprintf(path, sizeof(path), "%s/%s", dir, name);
+    snprintf(expected, sizeof(expected), "%s/%s", expected_dir, name);
+    Fixture_assert_same(path, expected);
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+#include <types.h>
+
+void test_directory_toc(void **state);
+
+void test_directory_link(void **state);
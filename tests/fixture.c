@@ -0,0 +1,162 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmocka.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+
+#include <types.h>
+#include <simple.h>
+#include <input.h>
+#include <output.h>
+#include <matcher.h>
+#include <report.h>
+#include <fixture.h>
+
+/**
+ * State as `main` sets it up for converting `input` to `output`, on a single
+ * job unless test asks for more.
+ */
+State *Fixture_state(const char *input, const char *output) {
+    State *state = (State *) malloc(sizeof(State));
+    memset(state, 0, sizeof(State));
+    state->input = strdup(input);
+    state->output = strdup(output);
+    state->flag = FLAG_NoOp;
+    state->compress = OutputFormat_Plain;
+    state->jobs = 1;
+    return state;
+}
+
+void Fixture_free(State *state) {
+    if (state->in) fclose(state->in);
+    if (state->out) fclose(state->out);
+    Matcher_free(state->matcher);
+    Report_free(state->report);
+    free(state->input);
+    free(state->output);
+    free(state);
+}
+
+void Fixture_run(State *state) {
+    if (state->in == NULL) state->in = fopen(state->input, "r");
+    assert_non_null(state->in);
+    fix_content(state);
+}
+
+/**
+ * Convert content of file at `path` read from pipe as from stdin, child
+ * process writes it in.
+ */
+void Fixture_run_piped(State *state, const char *path) {
+    int fds[2];
+    assert_true(pipe(fds) == 0);
+    pid_t child = fork();
+    assert_true(child >= 0);
+    if (child == 0) {
+        close(fds[0]);
+        int fd = open(path, O_RDONLY);
+        char buffer[1 << 16];
+        ssize_t n = 0;
+        while (fd >= 0 && (n = read(fd, buffer, sizeof(buffer))) > 0) {
+            if (write(fds[1], buffer, (size_t) n) != n)
+                _exit(1);
+        }
+        _exit(fd < 0 || n < 0);
+    }
+    close(fds[1]);
+    state->in = fdopen(fds[0], "r");
+    fix_content(state);
+
+    int status;
+    assert_true(waitpid(child, &status, 0) == child);
+    assert_true(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+}
+
+void Fixture_copy(const char *from, const char *to) {
+    size_t size;
+    char *data = Fixture_load(from, &size);
+    FILE *file = fopen(to, "w");
+    assert_non_null(file);
+    assert_int_equal(fwrite(data, 1, size, file), size);
+    assert_int_equal(fclose(file), 0);
+    free(data);
+}
+
+void Fixture_compress(const char *from, const char *to, OutputFormat format) {
+    size_t size;
+    char *data = Fixture_load(from, &size);
+    int fd = open(to, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    assert_true(fd >= 0);
+    Output *out = Output_init(fd, format, 1);
+    assert_int_equal(Output_write(out, data, size), 0);
+    assert_int_equal(Output_finish(out), 0);
+    Output_free(out);
+    close(fd);
+    free(data);
+}
+
+/**
+ * Dump fixture followed by COPY block of about `copy_size` bytes, `sections`
+ * times, and the fixture once more. Its fixed version goes to `expected`.
+ * COPY rows look like lines rules match, they have to be kept.
+ */
+void Fixture_large(const char *path, const char *expected, size_t sections, size_t copy_size) {
+    const char *rows[] = {"    AS integer\n", "SET transaction_timeout = 0;\n", "\\restrict row\n", "%zu\tplain row\n"};
+    size_t dump_size, fixed_size;
+    char *dump = Fixture_load("./examples/dump.psql", &dump_size);
+    char *fixed = Fixture_load("./examples/dump.fixed.psql", &fixed_size);
+    FILE *file = fopen(path, "w");
+    FILE *expected_file = fopen(expected, "w");
+    assert_non_null(file);
+    assert_non_null(expected_file);
+
+    for (size_t i = 0; i <= sections; i++) {
+        fwrite(dump, 1, dump_size, file);
+        fwrite(fixed, 1, fixed_size, expected_file);
+        if (i == sections)
+            break;
+        fputs("COPY public.big (line) FROM stdin;\n", file);
+        fputs("COPY public.big (line) FROM stdin;\n", expected_file);
+        for (size_t written = 0, row = 0; written < copy_size; row++) {
+            int len = fprintf(file, rows[row % 4], row);
+            fprintf(expected_file, rows[row % 4], row);
+            written += (size_t) len;
+        }
+        fputs("\\.\n", file);
+        fputs("\\.\n", expected_file);
+    }
+    assert_int_equal(fclose(file), 0);
+    assert_int_equal(fclose(expected_file), 0);
+    free(dump);
+    free(fixed);
+}
+
+/**
+ * Whole content of file, decompressed when it's compressed, NUL terminated.
+ */
+char *Fixture_load(const char *path, size_t *size) {
+    short mapped;
+    char *data = Input_load(path, size, &mapped);
+    assert_non_null(data);
+    char *copy = (char *) malloc(*size + 1);
+    memcpy(copy, data, *size);
+    copy[*size] = '\0';
+    if (mapped) munmap(data, *size);
+    else free(data);
+    return copy;
+}
+
+void Fixture_assert_same(const char *path, const char *expected) {
+    size_t size, expected_size;
+    char *data = Fixture_load(path, &size);
+    char *expected_data = Fixture_load(expected, &expected_size);
+    assert_int_equal(size, expected_size);
+    assert_memory_equal(data, expected_data, size);
+    free(data);
+    free(expected_data);
+}
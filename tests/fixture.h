@@ -0,0 +1,21 @@
+#pragma once
+
+#include <types.h>
+
+State *Fixture_state(const char *input, const char *output);
+
+void Fixture_free(State *state);
+
+void Fixture_run(State *state);
+
+void Fixture_run_piped(State *state, const char *path);
+
+void Fixture_copy(const char *from, const char *to);
+
+void Fixture_compress(const char *from, const char *to, OutputFormat format);
+
+void Fixture_large(const char *path, const char *expected, size_t sections, size_t copy_size);
+
+char *Fixture_load(const char *path, size_t *size);
+
+void Fixture_assert_same(const char *path, const char *expected);
@@ -0,0 +1,76 @@
+#define _GNU_SOURCE
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmocka.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include <types.h>
+#include <simple.h>
+#include <journal.h>
+#include <fixture.h>
+#include <journal_test.h>
+
+/**
+ * Checkpoint taken inside COPY data, output past it is garbage left by the
+ * interrupted run. Resumed conversion continues inside COPY data and ends
+ * the same as uninterrupted one.
+ */
+void test_journal_resume_checkpoint(void **state) {
+    Fixture_large("./tmp/journal.psql", "./tmp/journal.fixed.psql", 1, 1 << 20);
+    size_t size, expected_size;
+    char *data = Fixture_load("./tmp/journal.psql", &size);
+    char *expected = Fixture_load("./tmp/journal.fixed.psql", &expected_size);
+    const char *row = memmem(data + size / 2, size / 2, "\\restrict row\n", 14);
+    assert_non_null(row);
+    size_t in_offset = (size_t) (row - data);
+
+    State *fix = Fixture_state("./tmp/journal.psql", "./tmp/journal.out.psql");
+    char *prefix = (char *) malloc(in_offset);
+    memcpy(prefix, data, in_offset);
+    size_t out_offset = fix_string(fix, prefix, in_offset, 0);
+    assert_memory_equal(prefix, expected, out_offset);
+    free(prefix);
+
+    FILE *out = fopen("./tmp/journal.out.psql", "w");
+    assert_non_null(out);
+    assert_int_equal(fwrite(expected, 1, out_offset, out), out_offset);
+    fputs("left by interrupted run\n", out);
+    assert_int_equal(fclose(out), 0);
+
+    struct stat in_stat;
+    assert_int_equal(stat("./tmp/journal.psql", &in_stat), 0);
+    Journal *journal = Journal_init("./tmp/journal.out.psql", &in_stat);
+    Journal_hash(journal, expected, out_offset);
+    int fd = open("./tmp/journal.out.psql", O_RDWR);
+    assert_int_equal(Journal_save(journal, fd, in_offset, out_offset, 1), 0);
+    close(fd);
+    Journal_free(journal, 0);
+
+    fix->fixed = 0;
+    fix->resume = 1;
+    Fixture_run(fix);
+    assert_int_equal(fix->fixed, 7);
+    Fixture_free(fix);
+
+    Fixture_assert_same("./tmp/journal.out.psql", "./tmp/journal.fixed.psql");
+    assert_int_equal(access("./tmp/journal.out.psql.journal", F_OK), -1);
+    free(data);
+    free(expected);
+}
+
+void test_journal_resume_fresh(void **state) {
+    State *fix = Fixture_state("./examples/dump.psql", "./tmp/journal_fresh.psql");
+    fix->resume = 1;
+    Fixture_run(fix);
+    assert_int_equal(fix->fixed, 7);
+    Fixture_free(fix);
+
+    Fixture_assert_same("./tmp/journal_fresh.psql", "./examples/dump.fixed.psql");
+    assert_int_equal(access("./tmp/journal_fresh.psql.journal", F_OK), -1);
+}
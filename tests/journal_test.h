@@ -0,0 +1,7 @@
+#pragma once
+
+#include <types.h>
+
+void test_journal_resume_checkpoint(void **state);
+
+void test_journal_resume_fresh(void **state);
@@ -3,26 +3,39 @@
 #include <setjmp.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
+#include <wchar.h>
 #include <cmocka.h>
 
 #include <types.h>
 #include <lexer.h>
 #include <lexer_test.h>
 
+// Line of the generated input, 29 bytes and 5 tokens long
+#define BLOCK_LINE "SELECT c%06zu FROM t%06zu;\n"
+#define BLOCK_LINE_SIZE 29
+#define BLOCK_LINES 180000
+
+// Pair repeated in the long identifier, 3 bytes and 2 characters
+#define LONG_PAIR "xé"
+#define LONG_PAIRS 2000
+
+static void assert_block_token(const Lexer *lexer, size_t index);
+
 void test_lexer_create_extension(void **state) {
     Lexer *lexer = Lexer_init("./examples/create_extension.psql");
     assert_non_null(lexer);
 
     Lexer_tokenize(lexer);
     assert_true(lexer->tokenLen == 4);
-    assert_true(lexer->tokens[0]->type == LexerType_Keyword);
-    assert_true(lexer->tokens[0]->position.character == 1);
-    assert_true(lexer->tokens[1]->type == LexerType_Keyword);
-    assert_true(lexer->tokens[1]->position.character == 8);
-    assert_true(lexer->tokens[2]->type == LexerType_Identifier);
-    assert_true(lexer->tokens[2]->position.character == 18);
-    assert_true(lexer->tokens[3]->type == LexerType_Separator); // ;
-    assert_true(lexer->tokens[3]->position.character == 24); // ;
+    assert_true(Lexer_token(lexer, 0).type == LexerType_Keyword);
+    assert_true(Lexer_token(lexer, 0).position.character == 1);
+    assert_true(Lexer_token(lexer, 1).type == LexerType_Keyword);
+    assert_true(Lexer_token(lexer, 1).position.character == 8);
+    assert_true(Lexer_token(lexer, 2).type == LexerType_Identifier);
+    assert_true(Lexer_token(lexer, 2).position.character == 18);
+    assert_true(Lexer_token(lexer, 3).type == LexerType_Separator); // ;
+    assert_true(Lexer_token(lexer, 3).position.character == 24); // ;
 
     Lexer_free(lexer);
 }
@@ -33,17 +46,255 @@ void test_lexer_valid_select_star_from_table(void **state) {
 
     Lexer_tokenize(lexer);
     assert_true(lexer->tokenLen == 5);
-    assert_true(lexer->tokens[0]->type == LexerType_Keyword);
-    assert_true(lexer->tokens[0]->position.character == 1);
-    assert_true(lexer->tokens[1]->type == LexerType_Operator);
-    assert_true(lexer->tokens[1]->position.character == 8);
-    assert_true(lexer->tokens[2]->type == LexerType_Keyword);
-    assert_true(lexer->tokens[2]->position.character == 10);
-    assert_true(lexer->tokens[3]->type == LexerType_Identifier);
-    assert_true(lexer->tokens[3]->position.character == 15);
-    assert_true(lexer->tokens[4]->type == LexerType_Separator);
-    assert_true(lexer->tokens[4]->position.character == 20);
+    assert_true(Lexer_token(lexer, 0).type == LexerType_Keyword);
+    assert_true(Lexer_token(lexer, 0).position.character == 1);
+    assert_true(Lexer_token(lexer, 1).type == LexerType_Operator);
+    assert_true(Lexer_token(lexer, 1).position.character == 8);
+    assert_true(Lexer_token(lexer, 2).type == LexerType_Keyword);
+    assert_true(Lexer_token(lexer, 2).position.character == 10);
+    assert_true(Lexer_token(lexer, 3).type == LexerType_Identifier);
+    assert_true(Lexer_token(lexer, 3).position.character == 15);
+    assert_true(Lexer_token(lexer, 4).type == LexerType_Separator);
+    assert_true(Lexer_token(lexer, 4).position.character == 20);
+
+    Lexer_free(lexer);
+
+}
+
+void test_lexer_gzip_create_extension(void **state) {
+    Lexer *lexer = Lexer_init("./examples/create_extension.psql.gz");
+    assert_non_null(lexer);
+
+    Lexer_tokenize(lexer);
+    assert_true(lexer->tokenLen == 4);
+    assert_true(Lexer_token(lexer, 0).type == LexerType_Keyword);
+    assert_true(Lexer_token(lexer, 1).type == LexerType_Keyword);
+    assert_true(Lexer_token(lexer, 2).type == LexerType_Identifier);
+    assert_true(Lexer_token(lexer, 2).position.character == 18);
+    assert_true(Lexer_token(lexer, 3).type == LexerType_Separator);
 
     Lexer_free(lexer);
+}
+
+/**
+ * Multibyte characters at the start of input, straddling 32 and 16 byte
+ * vector widths and right after ASCII runs of those lengths. Positions count
+ * characters, not bytes, the same as before input was decoded in blocks.
+ */
+void test_lexer_multibyte_positions(void **state) {
+    Lexer *lexer = Lexer_init("./examples/multibyte.psql");
+    assert_non_null(lexer);
+
+    assert_true(Lexer_tokenize(lexer));
+    assert_int_equal(lexer->tokenLen, 31);
+    assert_int_equal(Lexer_token(lexer, 3).type, LexerType_Identifier); // ñandú
+    assert_int_equal(Lexer_token(lexer, 3).offset, 31);
+    assert_int_equal(Lexer_token(lexer, 3).position.character, 32);
+    assert_int_equal(Lexer_token(lexer, 3).position.position, 32);
+    assert_int_equal(Lexer_token(lexer, 4).position.character, 38); // FROM
+    assert_int_equal(Lexer_token(lexer, 4).position.position, 38);
+    assert_int_equal(Lexer_token(lexer, 5).position.character, 43); // café
+    assert_int_equal(Lexer_token(lexer, 5).position.position, 43);
+    assert_int_equal(Lexer_token(lexer, 6).position.character, 47); // ;
+    assert_int_equal(Lexer_token(lexer, 6).position.position, 46);
+
+    assert_int_equal(Lexer_token(lexer, 9).position.line, 1); // peña
+    assert_int_equal(Lexer_token(lexer, 9).position.character, 13);
+    assert_int_equal(Lexer_token(lexer, 9).position.position, 61);
+    assert_int_equal(Lexer_token(lexer, 10).position.character, 18); // VALUES
+    assert_int_equal(Lexer_token(lexer, 10).position.position, 66);
+    assert_int_equal(Lexer_token(lexer, 17).position.character, 32); // crème
+    assert_int_equal(Lexer_token(lexer, 17).position.position, 80);
+    assert_int_equal(Lexer_token(lexer, 18).position.character, 38); // brûlée
+    assert_int_equal(Lexer_token(lexer, 18).position.position, 86);
+    assert_int_equal(Lexer_token(lexer, 19).position.character, 44); // '
+    assert_int_equal(Lexer_token(lexer, 19).position.position, 91);
+
+    assert_int_equal(Lexer_token(lexer, 24).position.line, 2); // ünïcödé
+    assert_int_equal(Lexer_token(lexer, 24).position.character, 4);
+    assert_int_equal(Lexer_token(lexer, 24).position.position, 99);
+    assert_int_equal(Lexer_token(lexer, 27).offset, 131); // ✓
+    assert_int_equal(Lexer_token(lexer, 27).len, 3);
+    assert_int_equal(Lexer_token(lexer, 27).position.character, 26);
+    assert_int_equal(Lexer_token(lexer, 27).position.position, 121);
+    assert_int_equal(Lexer_token(lexer, 28).position.character, 28);
+    assert_int_equal(Lexer_token(lexer, 28).position.position, 123);
+    assert_int_equal(Lexer_token(lexer, 29).offset, 165); // 𝔸
+    assert_int_equal(Lexer_token(lexer, 29).len, 4);
+    assert_int_equal(Lexer_token(lexer, 29).position.character, 58);
+    assert_int_equal(Lexer_token(lexer, 29).position.position, 153);
+    assert_int_equal(Lexer_token(lexer, 30).type, LexerType_Identifier); // naïveté
+    assert_int_equal(Lexer_token(lexer, 30).position.character, 60);
+    assert_int_equal(Lexer_token(lexer, 30).position.position, 155);
+
+    Lexer_free(lexer);
+}
+
+/**
+ * Tokens are spans of input, text isn't terminated and is compared by bytes,
+ * case is folded for ASCII only.
+ */
+void test_lexer_multibyte_token(void **state) {
+    Lexer *lexer = Lexer_init("./examples/multibyte_token.psql");
+    assert_non_null(lexer);
+
+    assert_true(Lexer_tokenize(lexer));
+    assert_int_equal(lexer->tokenLen, 5);
+    LexerToken naive = Lexer_token(lexer, 1);
+    assert_int_equal(naive.type, LexerType_Identifier);
+    assert_int_equal(naive.offset, 7);
+    assert_int_equal(naive.len, strlen("Naïve"));
+    assert_memory_equal(LexerToken_text(lexer, &naive), "Naïve", naive.len);
+    wchar_t *wcs = LexerToken_wcs(lexer, &naive);
+    assert_int_equal(wcslen(wcs), 5);
+    assert_true(wcscmp(wcs, L"Naïve") == 0);
+    free(wcs);
+
+    assert_true(LexerToken_equals(lexer, &naive, "Naïve"));
+    assert_false(LexerToken_equals(lexer, &naive, "naïve"));
+    assert_false(LexerToken_equals(lexer, &naive, "Naïv"));
+    assert_true(LexerToken_iequals(lexer, &naive, "nAïVE"));
+    assert_false(LexerToken_iequals(lexer, &naive, "NAÏVE"));
+    assert_false(LexerToken_iequals(lexer, &naive, "naïves"));
+
+    LexerToken cafe = Lexer_token(lexer, 3);
+    assert_int_equal(cafe.len, strlen("café"));
+    assert_true(LexerToken_equals(lexer, &cafe, "café"));
+    assert_false(LexerToken_equals(lexer, &cafe, "café;"));
+    assert_true(LexerToken_iequals(lexer, &cafe, "CAFé"));
+    wcs = LexerToken_wcs(lexer, &cafe);
+    assert_true(wcscmp(wcs, L"café") == 0);
+    free(wcs);
+
+    LexerToken from = Lexer_token(lexer, 2);
+    assert_int_equal(from.type, LexerType_Keyword);
+    assert_true(LexerToken_iequals(lexer, &from, "from"));
+
+    Lexer_free(lexer);
+}
+
+/**
+ * Keywords match in any case, words of the same length that aren't keywords
+ * stay identifiers.
+ */
+void test_lexer_keyword_case(void **state) {
+    Lexer *lexer = Lexer_init("./examples/lowercase.psql");
+    assert_non_null(lexer);
+
+    assert_true(Lexer_tokenize(lexer));
+    assert_int_equal(lexer->tokenLen, 14);
+    assert_int_equal(Lexer_token(lexer, 0).type, LexerType_Keyword); // select
+    assert_int_equal(Lexer_token(lexer, 1).type, LexerType_Operator);
+    assert_int_equal(Lexer_token(lexer, 2).type, LexerType_Keyword); // from
+    assert_int_equal(Lexer_token(lexer, 3).type, LexerType_Identifier); // users
+    assert_int_equal(Lexer_token(lexer, 3).position.character, 15);
+    assert_int_equal(Lexer_token(lexer, 4).type, LexerType_Separator);
+
+    assert_int_equal(Lexer_token(lexer, 5).type, LexerType_Keyword); // SeLeCt
+    assert_int_equal(Lexer_token(lexer, 6).type, LexerType_Keyword); // a
+    assert_int_equal(Lexer_token(lexer, 7).type, LexerType_Keyword); // FROM
+    assert_int_equal(Lexer_token(lexer, 8).type, LexerType_Keyword); // t
+    assert_int_equal(Lexer_token(lexer, 9).type, LexerType_Keyword); // WhErE
+    assert_int_equal(Lexer_token(lexer, 10).type, LexerType_Identifier); // tabel
+    assert_int_equal(Lexer_token(lexer, 10).position.character, 23);
+    assert_int_equal(Lexer_token(lexer, 12).type, LexerType_Literal);
+
+    Lexer_free(lexer);
+}
+
+/**
+ * Input long enough for the token reservation to be capped and the stream to
+ * grow several times, tokens on both sides of every block boundary are read
+ * back relative to their own block.
+ */
+void test_lexer_token_blocks(void **state) {
+    FILE *file = fopen("./tmp/lexer_blocks.psql", "w");
+    assert_non_null(file);
+    for (size_t i = 0; i < BLOCK_LINES; i++)
+        fprintf(file, BLOCK_LINE, i, i);
+    assert_int_equal(fclose(file), 0);
+
+    Lexer *lexer = Lexer_init("./tmp/lexer_blocks.psql");
+    assert_non_null(lexer);
+    assert_int_equal(lexer->size, BLOCK_LINES * BLOCK_LINE_SIZE);
+    assert_int_equal(lexer->tokens.cap, (1 << 16) + LEXER_TOKEN_BLOCK);
+
+    assert_true(Lexer_tokenize(lexer));
+    assert_int_equal(lexer->tokenLen, BLOCK_LINES * 5);
+    assert_true(lexer->tokens.cap >= lexer->tokenLen);
+    assert_int_equal(lexer->tokens.wideLen, 0);
+    for (size_t index = LEXER_TOKEN_BLOCK; index < lexer->tokenLen; index += LEXER_TOKEN_BLOCK) {
+        assert_block_token(lexer, index - 1);
+        assert_block_token(lexer, index);
+    }
+    assert_block_token(lexer, 0);
+    assert_block_token(lexer, lexer->tokenLen - 1);
+
+    Lexer_free(lexer);
+}
+
+/**
+ * Identifier several KiB long with a multibyte character every other one is
+ * a single span of input.
+ */
+void test_lexer_long_lexeme(void **state) {
+    size_t size = strlen(LONG_PAIR) * LONG_PAIRS + 1;
+    char *identifier = (char *) malloc(size + 1);
+    wchar_t *expected = (wchar_t *) malloc(sizeof(wchar_t) * (LONG_PAIRS * 2 + 2));
+    for (size_t i = 0; i < LONG_PAIRS; i++) {
+        memcpy(identifier + i * strlen(LONG_PAIR), LONG_PAIR, strlen(LONG_PAIR));
+        expected[i * 2] = L'x';
+        expected[i * 2 + 1] = L'é';
+    }
+    identifier[size - 1] = 'y';
+    identifier[size] = '\0';
+    expected[LONG_PAIRS * 2] = L'y';
+    expected[LONG_PAIRS * 2 + 1] = 0;
+
+    FILE *file = fopen("./tmp/lexer_long.psql", "w");
+    assert_non_null(file);
+    fprintf(file, "SELECT %s FROM t;\n", identifier);
+    assert_int_equal(fclose(file), 0);
+
+    Lexer *lexer = Lexer_init("./tmp/lexer_long.psql");
+    assert_non_null(lexer);
+    assert_true(Lexer_tokenize(lexer));
+    assert_int_equal(lexer->tokenLen, 5);
+
+    LexerToken token = Lexer_token(lexer, 1);
+    assert_int_equal(token.type, LexerType_Identifier);
+    assert_int_equal(token.offset, 7);
+    assert_int_equal(token.len, size);
+    assert_memory_equal(LexerToken_text(lexer, &token), identifier, size);
+    assert_true(LexerToken_equals(lexer, &token, identifier));
+    wchar_t *wcs = LexerToken_wcs(lexer, &token);
+    assert_int_equal(wcslen(wcs), LONG_PAIRS * 2 + 1);
+    assert_true(wcscmp(wcs, expected) == 0);
+    free(wcs);
+
+    LexerToken from = Lexer_token(lexer, 2);
+    assert_int_equal(from.type, LexerType_Keyword);
+    assert_int_equal(from.offset, 7 + size + 1);
+    assert_int_equal(from.position.character, 8 + LONG_PAIRS * 2 + 2);
+    assert_int_equal(from.position.position, 8 + LONG_PAIRS * 2 + 2);
+
+    Lexer_free(lexer);
+    free(identifier);
+    free(expected);
+}
 
+static void assert_block_token(const Lexer *lexer, size_t index) {
+    const LexerType types[] = {LexerType_Keyword, LexerType_Identifier, LexerType_Keyword, LexerType_Identifier, LexerType_Separator};
+    const size_t columns[] = {0, 7, 15, 20, 27};
+    const size_t lens[] = {6, 7, 4, 7, 1};
+    size_t line = index / 5;
+    size_t column = columns[index % 5];
+    LexerToken token = Lexer_token(lexer, index);
+    assert_int_equal(token.type, types[index % 5]);
+    assert_int_equal(token.offset, line * BLOCK_LINE_SIZE + column);
+    assert_int_equal(token.len, lens[index % 5]);
+    assert_int_equal(token.position.line, line);
+    assert_int_equal(token.position.character, column + 1);
+    // separator is counted from 0, words from 1
+    assert_int_equal(token.position.position, line * BLOCK_LINE_SIZE + column + (index % 5 != 4));
 }
@@ -5,3 +5,15 @@
 void test_lexer_create_extension(void **state);
 
 void test_lexer_valid_select_star_from_table(void **state);
+
+void test_lexer_gzip_create_extension(void **state);
+
+void test_lexer_multibyte_positions(void **state);
+
+void test_lexer_multibyte_token(void **state);
+
+void test_lexer_keyword_case(void **state);
+
+void test_lexer_token_blocks(void **state);
+
+void test_lexer_long_lexeme(void **state);
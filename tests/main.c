@@ -5,14 +5,54 @@
 
 #include <lexer_test.h>
 #include <parser_test.h>
+#include <simple_test.h>
+#include <output_test.h>
+#include <archive_test.h>
+#include <directory_test.h>
+#include <journal_test.h>
+#include <slice_test.h>
 
 int main(void) {
     const struct CMUnitTest tests[] = {
-//            cmocka_unit_test(test_lexer_create_extension),
-//            cmocka_unit_test(test_lexer_valid_select_star_from_table),
+            cmocka_unit_test(test_lexer_create_extension),
+            cmocka_unit_test(test_lexer_valid_select_star_from_table),
+            cmocka_unit_test(test_lexer_gzip_create_extension),
+            cmocka_unit_test(test_lexer_multibyte_positions),
+            cmocka_unit_test(test_lexer_multibyte_token),
+            cmocka_unit_test(test_lexer_keyword_case),
+            cmocka_unit_test(test_lexer_token_blocks),
+            cmocka_unit_test(test_lexer_long_lexeme),
 //            cmocka_unit_test(test_parser_select_add),
 //            cmocka_unit_test(test_parser_syntax_error_table),
             cmocka_unit_test(test_parser_valid_select_star_from_table),
+            cmocka_unit_test(test_simple_mapped_dump),
+            cmocka_unit_test(test_simple_mapped_unchanged),
+            cmocka_unit_test(test_simple_streamed_dump),
+            cmocka_unit_test(test_simple_in_place_staged),
+            cmocka_unit_test(test_simple_in_place_unchanged),
+            cmocka_unit_test(test_simple_compressed_input),
+            cmocka_unit_test(test_simple_compressed_output),
+            cmocka_unit_test(test_simple_candidate_alignment),
+            cmocka_unit_test(test_simple_rules_single_pass),
+            cmocka_unit_test(test_simple_blocks_regular_file),
+            cmocka_unit_test(test_simple_parallel_chunks),
+            cmocka_unit_test(test_simple_copy_passthrough),
+            cmocka_unit_test(test_simple_dry_report),
+            cmocka_unit_test(test_simple_windows),
+            cmocka_unit_test(test_simple_streamed_pipeline),
+            cmocka_unit_test(test_simple_in_place_compacted),
+            cmocka_unit_test(test_simple_in_place_compact_resume),
+            cmocka_unit_test(test_output_compressed_blocks),
+            cmocka_unit_test(test_output_compressed_empty),
+            cmocka_unit_test(test_output_source_ranges),
+            cmocka_unit_test(test_archive_custom_sequence),
+            cmocka_unit_test(test_archive_custom_unchanged),
+            cmocka_unit_test(test_directory_toc),
+            cmocka_unit_test(test_directory_link),
+            cmocka_unit_test(test_journal_resume_checkpoint),
+            cmocka_unit_test(test_journal_resume_fresh),
+            cmocka_unit_test(test_slice_merge_ranges),
+            cmocka_unit_test(test_slice_merge_wrong_guess),
     };
     return cmocka_run_group_tests(tests, NULL, NULL);
 }
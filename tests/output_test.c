@@ -0,0 +1,164 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmocka.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+#include <types.h>
+#include <output.h>
+#include <fixture.h>
+#include <output_test.h>
+
+static const unsigned char GZIP_MAGIC[] = {0x1f, 0x8b};
+
+static const unsigned char ZSTD_MAGIC[] = {0x28, 0xb5, 0x2f, 0xfd};
+
+static void assert_magic(const char *path, const unsigned char *magic, size_t len);
+
+static void write_compressed(OutputFormat format, const char *path, const char *data, size_t size, size_t step);
+
+static void write_sourced(int fd, int in_fd, const char *data, size_t size);
+
+/**
+ * Several blocks worth of dump written in uneven pieces come out as separate
+ * members or frames of one valid stream.
+ */
+void test_output_compressed_blocks(void **state) {
+    size_t size;
+    char *dump = Fixture_load("./examples/dump.psql", &size);
+    size_t len = 0;
+    char *data = (char *) malloc(size * 2048);
+    while (len < size * 2048) {
+        memcpy(data + len, dump, size);
+        len += size;
+    }
+    FILE *expected = fopen("./tmp/output_blocks.psql", "w");
+    assert_non_null(expected);
+    assert_int_equal(fwrite(data, 1, len, expected), len);
+    fclose(expected);
+
+    if (Output_supports(OutputFormat_Gzip)) {
+        write_compressed(OutputFormat_Gzip, "./tmp/output_blocks.psql.gz", data, len, 4093);
+        assert_magic("./tmp/output_blocks.psql.gz", GZIP_MAGIC, sizeof(GZIP_MAGIC));
+        Fixture_assert_same("./tmp/output_blocks.psql.gz", "./tmp/output_blocks.psql");
+    }
+    if (Output_supports(OutputFormat_Zstd)) {
+        write_compressed(OutputFormat_Zstd, "./tmp/output_blocks.psql.zst", data, len, 3 << 20);
+        assert_magic("./tmp/output_blocks.psql.zst", ZSTD_MAGIC, sizeof(ZSTD_MAGIC));
+        Fixture_assert_same("./tmp/output_blocks.psql.zst", "./tmp/output_blocks.psql");
+    }
+    free(data);
+    free(dump);
+}
+
+void test_output_compressed_empty(void **state) {
+    FILE *expected = fopen("./tmp/output_empty.psql", "w");
+    assert_non_null(expected);
+    fclose(expected);
+
+    if (Output_supports(OutputFormat_Gzip)) {
+        write_compressed(OutputFormat_Gzip, "./tmp/output_empty.psql.gz", NULL, 0, 0);
+        assert_magic("./tmp/output_empty.psql.gz", GZIP_MAGIC, sizeof(GZIP_MAGIC));
+        Fixture_assert_same("./tmp/output_empty.psql.gz", "./tmp/output_empty.psql");
+    }
+    if (Output_supports(OutputFormat_Zstd)) {
+        write_compressed(OutputFormat_Zstd, "./tmp/output_empty.psql.zst", NULL, 0, 0);
+        assert_magic("./tmp/output_empty.psql.zst", ZSTD_MAGIC, sizeof(ZSTD_MAGIC));
+        Fixture_assert_same("./tmp/output_empty.psql.zst", "./tmp/output_empty.psql");
+    }
+}
+
+/**
+ * Long unchanged spans of mapped input are copied by kernel, into regular
+ * file and through pipe alike, and keep their place among written ones.
+ */
+void test_output_source_ranges(void **state) {
+    Fixture_large("./tmp/source.psql", "./tmp/source.fixed.psql", 2, 1 << 20);
+    int in_fd = open("./tmp/source.psql", O_RDONLY);
+    struct stat in_stat;
+    assert_int_equal(fstat(in_fd, &in_stat), 0);
+    size_t size = (size_t) in_stat.st_size;
+    char *data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, in_fd, 0);
+    assert_true(data != MAP_FAILED);
+
+    FILE *expected = fopen("./tmp/source.expected.psql", "w");
+    assert_non_null(expected);
+    fwrite(data, 1, 100000, expected);
+    fputs("edited\n", expected);
+    fwrite(data + 300000, 1, 100, expected);
+    fwrite(data + 400000, 1, size - 400000, expected);
+    assert_int_equal(fclose(expected), 0);
+
+    int fd = open("./tmp/source.out.psql", O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    assert_true(fd >= 0);
+    write_sourced(fd, in_fd, data, size);
+    close(fd);
+    Fixture_assert_same("./tmp/source.out.psql", "./tmp/source.expected.psql");
+
+    int fds[2];
+    assert_int_equal(pipe(fds), 0);
+    pid_t child = fork();
+    assert_true(child >= 0);
+    if (child == 0) {
+        close(fds[1]);
+        int to = open("./tmp/source.piped.psql", O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        char buffer[1 << 16];
+        ssize_t n = 0;
+        while (to >= 0 && (n = read(fds[0], buffer, sizeof(buffer))) > 0) {
+            if (write(to, buffer, (size_t) n) != n)
+                _exit(1);
+        }
+        _exit(to < 0 || n < 0);
+    }
+    close(fds[0]);
+    write_sourced(fds[1], in_fd, data, size);
+    close(fds[1]);
+    int status;
+    assert_true(waitpid(child, &status, 0) == child);
+    assert_true(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    Fixture_assert_same("./tmp/source.piped.psql", "./tmp/source.expected.psql");
+
+    munmap(data, size);
+    close(in_fd);
+}
+
+static void assert_magic(const char *path, const unsigned char *magic, size_t len) {
+    unsigned char head[4];
+    FILE *file = fopen(path, "r");
+    assert_non_null(file);
+    assert_int_equal(fread(head, 1, len, file), len);
+    fclose(file);
+    assert_memory_equal(head, magic, len);
+}
+
+static void write_compressed(OutputFormat format, const char *path, const char *data, size_t size, size_t step) {
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    assert_true(fd >= 0);
+    Output *out = Output_init(fd, format, 4);
+    for (size_t pos = 0; pos < size; pos += step) {
+        size_t len = size - pos < step ? size - pos : step;
+        assert_int_equal(Output_write(out, data + pos, len), 0);
+        assert_int_equal(Output_flush(out), 0);
+    }
+    assert_int_equal(Output_finish(out), 0);
+    Output_free(out);
+    close(fd);
+}
+
+static void write_sourced(int fd, int in_fd, const char *data, size_t size) {
+    Output *out = Output_init(fd, OutputFormat_Plain, 0);
+    Output_source(out, in_fd, data, size);
+    assert_int_equal(Output_write(out, data, 100000), 0);
+    assert_int_equal(Output_write(out, "edited\n", 7), 0);
+    assert_int_equal(Output_write(out, data + 300000, 100), 0);
+    assert_int_equal(Output_flush(out), 0);
+    assert_int_equal(Output_write(out, data + 400000, size - 400000), 0);
+    assert_int_equal(Output_finish(out), 0);
+    Output_free(out);
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <types.h>
+
+void test_output_compressed_blocks(void **state);
+
+void test_output_compressed_empty(void **state);
+
+void test_output_source_ranges(void **state);
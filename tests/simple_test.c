@@ -0,0 +1,483 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmocka.h>
+#include <glob.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include <types.h>
+#include <simple.h>
+#include <output.h>
+#include <report.h>
+#include <journal.h>
+#include <uring.h>
+#include <fixture.h>
+#include <simple_test.h>
+
+#ifndef FIXPQ_WINDOW_SIZE
+#define FIXPQ_WINDOW_SIZE (1 << 20)
+#endif
+
+void test_simple_mapped_dump(void **state) {
+    State *fix = Fixture_state("./examples/dump.psql", "./tmp/mapped_dump.psql");
+    Fixture_run(fix);
+    assert_int_equal(fix->fixed, 7);
+    Fixture_free(fix);
+
+    Fixture_assert_same("./tmp/mapped_dump.psql", "./examples/dump.fixed.psql");
+}
+
+void test_simple_mapped_unchanged(void **state) {
+    State *fix = Fixture_state("./examples/dump.fixed.psql", "./tmp/mapped_unchanged.psql");
+    Fixture_run(fix);
+    assert_int_equal(fix->fixed, 0);
+    Fixture_free(fix);
+
+    Fixture_assert_same("./tmp/mapped_unchanged.psql", "./examples/dump.fixed.psql");
+}
+
+void test_simple_streamed_dump(void **state) {
+    State *fix = Fixture_state("-", "./tmp/streamed_dump.psql");
+    Fixture_run_piped(fix, "./examples/dump.psql");
+    assert_int_equal(fix->fixed, 7);
+    Fixture_free(fix);
+
+    Fixture_assert_same("./tmp/streamed_dump.psql", "./examples/dump.fixed.psql");
+}
+
+void test_simple_in_place_staged(void **state) {
+    struct stat before, after;
+    Fixture_copy("./examples/dump.psql", "./tmp/in_place.psql");
+    assert_int_equal(chmod("./tmp/in_place.psql", 0640), 0);
+    assert_int_equal(stat("./tmp/in_place.psql", &before), 0);
+
+    State *fix = Fixture_state("./tmp/in_place.psql", "./tmp/in_place.psql");
+    Fixture_run(fix);
+    assert_null(fix->staged);
+    Fixture_free(fix);
+
+    // staged copy replaced input, nothing of it is left behind
+    assert_int_equal(stat("./tmp/in_place.psql", &after), 0);
+    assert_true(after.st_ino != before.st_ino);
+    assert_int_equal(after.st_mode & 07777, 0640);
+    glob_t staged;
+    assert_int_equal(glob("./tmp/in_place.psql.*", 0, NULL, &staged), GLOB_NOMATCH);
+    globfree(&staged);
+    Fixture_assert_same("./tmp/in_place.psql", "./examples/dump.fixed.psql");
+}
+
+void test_simple_in_place_unchanged(void **state) {
+    struct stat before, after;
+    Fixture_copy("./examples/dump.fixed.psql", "./tmp/in_place_unchanged.psql");
+    assert_int_equal(stat("./tmp/in_place_unchanged.psql", &before), 0);
+
+    State *fix = Fixture_state("./tmp/in_place_unchanged.psql", "./tmp/in_place_unchanged.psql");
+    Fixture_run(fix);
+    assert_int_equal(fix->fixed, 0);
+    Fixture_free(fix);
+
+    assert_int_equal(stat("./tmp/in_place_unchanged.psql", &after), 0);
+    assert_int_equal(after.st_ino, before.st_ino);
+    assert_int_equal(after.st_mtim.tv_sec, before.st_mtim.tv_sec);
+    assert_int_equal(after.st_mtim.tv_nsec, before.st_mtim.tv_nsec);
+    Fixture_assert_same("./tmp/in_place_unchanged.psql", "./examples/dump.fixed.psql");
+}
+
+void test_simple_compressed_input(void **state) {
+    const char *inputs[] = {
+#ifdef FIXPQ_WITH_ZLIB
+            "./examples/dump.psql.gz",
+#endif
+#ifdef FIXPQ_WITH_ZSTD
+            "./examples/dump.psql.zst",
+#endif
+#ifdef FIXPQ_WITH_LZ4
+            "./examples/dump.psql.lz4",
+#endif
+            NULL,
+    };
+    for (size_t i = 0; inputs[i]; i++) {
+        State *fix = Fixture_state(inputs[i], "./tmp/compressed_input.psql");
+        Fixture_run(fix);
+        assert_true(fix->compressed);
+        assert_int_equal(fix->fixed, 7);
+        Fixture_free(fix);
+
+        // output is plain, loader below would decompress it either way
+        char head[3];
+        FILE *out = fopen("./tmp/compressed_input.psql", "r");
+        assert_non_null(out);
+        assert_int_equal(fread(head, 1, sizeof(head), out), sizeof(head));
+        fclose(out);
+        assert_memory_equal(head, "--\n", sizeof(head));
+        Fixture_assert_same("./tmp/compressed_input.psql", "./examples/dump.fixed.psql");
+    }
+}
+
+void test_simple_compressed_output(void **state) {
+    const OutputFormat formats[] = {OutputFormat_Gzip, OutputFormat_Zstd};
+    for (size_t i = 0; i < sizeof(formats) / sizeof(formats[0]); i++) {
+        if (!Output_supports(formats[i]))
+            continue;
+        State *fix = Fixture_state("./examples/dump.psql", "./tmp/compressed_output.psql.z");
+        fix->compress = formats[i];
+        fix->jobs = 4;
+        Fixture_run(fix);
+        Fixture_free(fix);
+
+        Fixture_assert_same("./tmp/compressed_output.psql.z", "./examples/dump.fixed.psql");
+    }
+}
+
+/**
+ * Candidate lines land at every offset of vector the scanner loads, data
+ * itself starts at unaligned address too.
+ */
+void test_simple_candidate_alignment(void **state) {
+    const char *lines = "    AS integer\n    AS integers\nSET transaction_timeout = 0;\n  AS integer\n"
+                        "SET transaction_timeout = 0;";
+    const char *kept = "    AS integers\n  AS integer\n";
+    State *fix = Fixture_state("-", "-");
+    for (size_t shift = 0; shift < 128; shift++) {
+        char *buffer = (char *) malloc(512);
+        char *str = buffer + shift % 32;
+        char expected[512];
+        size_t pad = (size_t) snprintf(str, 256, "--%.*s\n", (int) shift,
+                                       "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx"
+                                       "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx");
+        memcpy(expected, str, pad);
+        memcpy(expected + pad, kept, strlen(kept));
+        memcpy(str + pad, lines, strlen(lines));
+
+        size_t len = fix_string(fix, str, pad + strlen(lines), 0);
+        assert_int_equal(len, pad + strlen(kept));
+        assert_memory_equal(str, expected, len);
+        free(buffer);
+    }
+    assert_int_equal(fix->fixed, 128 * 3);
+    Fixture_free(fix);
+}
+
+/**
+ * Every rule is found in one pass in input order, lines only resembling
+ * a rule are kept.
+ */
+void test_simple_rules_single_pass(void **state) {
+    const char *rules[] = {"\\restrict", "transaction_timeout", "AS integer", "default_table_access_method",
+                           "AS bigint", "AS smallint", "\\unrestrict"};
+    char str[] = "\\restrict abc\n"
+                 "\\restricted abc\n"
+                 "SET transaction_timeout = 0;\n"
+                 "SET transaction_timeout = 10;\n"
+                 "    AS integer\n"
+                 "AS integer\n"
+                 "    AS integer NOT NULL\n"
+                 "SET default_table_access_method = heap;\n"
+                 "SET default_table_access_method = heap2;\n"
+                 "    AS bigint\n"
+                 "    AS smallint\n"
+                 "    as smallint\n"
+                 "\\unrestrict abc\n";
+    const char *expected = "\\restricted abc\n"
+                           "SET transaction_timeout = 10;\n"
+                           "AS integer\n"
+                           "    AS integer NOT NULL\n"
+                           "SET default_table_access_method = heap2;\n"
+                           "    as smallint\n";
+    State *fix = Fixture_state("-", "-");
+    fix->report = Report_init();
+    size_t len = fix_string(fix, str, strlen(str), 0);
+    assert_int_equal(len, strlen(expected));
+    assert_memory_equal(str, expected, len);
+
+    assert_int_equal(fix->report->hitLen, sizeof(rules) / sizeof(rules[0]));
+    for (size_t i = 0; i < fix->report->hitLen; i++)
+        assert_string_equal(fix->matcher->rules[fix->report->hits[i].rule].name, rules[i]);
+    Fixture_free(fix);
+}
+
+/**
+ * Regular file several read blocks long goes through io_uring, written at
+ * block offsets and staged in place the same way. Skipped where kernel
+ * has no usable ring, mapped path would be tested instead.
+ */
+void test_simple_blocks_regular_file(void **state) {
+    Uring *ring = Uring_init(8);
+    if (ring == NULL)
+        skip();
+    Uring_free(ring);
+    Fixture_large("./tmp/blocks.psql", "./tmp/blocks.fixed.psql", 3, 2 << 20);
+
+    State *fix = Fixture_state("./tmp/blocks.psql", "./tmp/blocks.out.psql");
+    Fixture_run(fix);
+    assert_true(fix->uring);
+    assert_int_equal(fix->fixed, 4 * 7);
+    Fixture_free(fix);
+    Fixture_assert_same("./tmp/blocks.out.psql", "./tmp/blocks.fixed.psql");
+
+    fix = Fixture_state("./tmp/blocks.psql", "./tmp/blocks.psql");
+    Fixture_run(fix);
+    assert_true(fix->uring);
+    Fixture_free(fix);
+    Fixture_assert_same("./tmp/blocks.psql", "./tmp/blocks.fixed.psql");
+}
+
+/**
+ * Input over chunk size is scanned in parallel chunks, one of them starts
+ * inside COPY data. Output must be byte for byte the serial one.
+ */
+void test_simple_parallel_chunks(void **state) {
+    Fixture_large("./tmp/chunks.psql", "./tmp/chunks.fixed.psql", 6, 7 << 19);
+
+    State *fix = Fixture_state("./tmp/chunks.psql", "./tmp/chunks.serial.psql");
+    Fixture_run(fix);
+    assert_int_equal(fix->fixed, 7 * 7);
+    Fixture_free(fix);
+
+    fix = Fixture_state("./tmp/chunks.psql", "./tmp/chunks.parallel.psql");
+    fix->jobs = 4;
+    Fixture_run(fix);
+    assert_int_equal(fix->fixed, 7 * 7);
+    Fixture_free(fix);
+
+    Fixture_assert_same("./tmp/chunks.parallel.psql", "./tmp/chunks.serial.psql");
+    Fixture_assert_same("./tmp/chunks.serial.psql", "./tmp/chunks.fixed.psql");
+}
+
+/**
+ * COPY data is passed through up to its terminator however long its header
+ * is, rules apply again after it.
+ */
+void test_simple_copy_passthrough(void **state) {
+    FILE *file = fopen("./tmp/copy.psql", "w");
+    FILE *expected = fopen("./tmp/copy.fixed.psql", "w");
+    assert_non_null(file);
+    assert_non_null(expected);
+    const char *before = "SELECT 1;\nCOPY public.t (a) TO stdout;\n";
+    fputs(before, file);
+    fputs(before, expected);
+    fputs("    AS integer\n", file);
+    fputs("COPY public.wide (c0", file);
+    fputs("COPY public.wide (c0", expected);
+    for (size_t i = 1; i < 2000; i++) {
+        fprintf(file, ", c%zu", i);
+        fprintf(expected, ", c%zu", i);
+    }
+    const char *data = ") FROM stdin;\n    AS integer\nSET transaction_timeout = 0;\n\\restrict row\n\\.\n";
+    fputs(data, file);
+    fputs(data, expected);
+    fputs("    AS integer\n\\unrestrict abc\n", file);
+    assert_int_equal(fclose(file), 0);
+    assert_int_equal(fclose(expected), 0);
+
+    State *fix = Fixture_state("./tmp/copy.psql", "./tmp/copy.mapped.psql");
+    Fixture_run(fix);
+    assert_int_equal(fix->fixed, 3);
+    Fixture_free(fix);
+    Fixture_assert_same("./tmp/copy.mapped.psql", "./tmp/copy.fixed.psql");
+
+    fix = Fixture_state("-", "./tmp/copy.streamed.psql");
+    Fixture_run_piped(fix, "./tmp/copy.psql");
+    assert_int_equal(fix->fixed, 3);
+    Fixture_free(fix);
+    Fixture_assert_same("./tmp/copy.streamed.psql", "./tmp/copy.fixed.psql");
+}
+
+/**
+ * Dry run writes nothing, mapped and streamed input report the same hits.
+ */
+void test_simple_dry_report(void **state) {
+    const size_t offsets[] = {35, 256, 559, 923, 1192, 1401, 1965};
+    const size_t lines[] = {5, 13, 24, 44, 59, 72, 105};
+    for (short piped = 0; piped < 2; piped++) {
+        State *fix = Fixture_state(piped ? "-" : "./examples/dump.psql", "./tmp/dry.psql");
+        fix->dry = 1;
+        fix->report = Report_init();
+        if (piped) Fixture_run_piped(fix, "./examples/dump.psql");
+        else Fixture_run(fix);
+        assert_int_equal(access("./tmp/dry.psql", F_OK), -1);
+
+        assert_int_equal(fix->report->scanned, 2022);
+        assert_int_equal(fix->report->hitLen, 7);
+        for (size_t i = 0; i < fix->report->hitLen; i++) {
+            assert_int_equal(fix->report->hits[i].offset, offsets[i]);
+            assert_int_equal(fix->report->hits[i].line, lines[i]);
+        }
+
+        char json[2048];
+        FILE *out = fmemopen(json, sizeof(json), "w");
+        Report_print(fix->report, fix->matcher, "dump.psql", out);
+        fclose(out);
+        const char *head = "{\"input\": \"dump.psql\", \"bytes_scanned\": 2022, ";
+        assert_memory_equal(json, head, strlen(head));
+        assert_non_null(strstr(json, "\"matches\": 7, "));
+        assert_non_null(strstr(json, "{\"rule\": \"\\\\unrestrict\", \"offset\": 1965, \"line\": 105}]}\n"));
+        Fixture_free(fix);
+    }
+}
+
+/**
+ * Rule line straddles the first window boundary and follows a line longer
+ * than two windows. Windows of mapped and streamed input give the output
+ * whole input converted at once does.
+ */
+void test_simple_windows(void **state) {
+    size_t dump_size, fixed_size;
+    char *dump = Fixture_load("./examples/dump.psql", &dump_size);
+    char *fixed = Fixture_load("./examples/dump.fixed.psql", &fixed_size);
+    const size_t filler = FIXPQ_WINDOW_SIZE - 5 - dump_size - 4;
+    const size_t long_line = FIXPQ_WINDOW_SIZE * 5 / 2;
+    FILE *file = fopen("./tmp/windows.psql", "w");
+    FILE *expected = fopen("./tmp/windows.fixed.psql", "w");
+    assert_non_null(file);
+    assert_non_null(expected);
+    for (short i = 0; i < 2; i++) {
+        FILE *to = i ? expected : file;
+        fwrite(i ? fixed : dump, 1, i ? fixed_size : dump_size, to);
+        fputs("-- ", to);
+        for (size_t j = 0; j < filler; j++) fputc('x', to);
+        fputs("\n", to);
+        if (!i) fputs("    AS integer\n", to);
+        fputs("-- ", to);
+        for (size_t j = 0; j < long_line; j++) fputc('y', to);
+        fputs("\n", to);
+        if (!i) fputs("SET transaction_timeout = 0;\n", to);
+        fwrite(i ? fixed : dump, 1, i ? fixed_size : dump_size, to);
+    }
+    assert_int_equal(fclose(file), 0);
+    assert_int_equal(fclose(expected), 0);
+
+    size_t size;
+    State *fix = Fixture_state("-", "-");
+    char *whole = Fixture_load("./tmp/windows.psql", &size);
+    size = fix_string(fix, whole, size, 0);
+    assert_int_equal(fix->fixed, 16);
+    Fixture_free(fix);
+    file = fopen("./tmp/windows.whole.psql", "w");
+    assert_non_null(file);
+    fwrite(whole, 1, size, file);
+    assert_int_equal(fclose(file), 0);
+    Fixture_assert_same("./tmp/windows.whole.psql", "./tmp/windows.fixed.psql");
+
+    fix = Fixture_state("./tmp/windows.psql", "./tmp/windows.mapped.psql");
+    Fixture_run(fix);
+    assert_int_equal(fix->fixed, 16);
+    Fixture_free(fix);
+    Fixture_assert_same("./tmp/windows.mapped.psql", "./tmp/windows.fixed.psql");
+
+    if (Output_supports(OutputFormat_Gzip)) {
+        fix = Fixture_state("./tmp/windows.psql", "./tmp/windows.mapped.psql.gz");
+        fix->compress = OutputFormat_Gzip;
+        Fixture_run(fix);
+        assert_int_equal(fix->fixed, 16);
+        Fixture_free(fix);
+        Fixture_assert_same("./tmp/windows.mapped.psql.gz", "./tmp/windows.fixed.psql");
+    }
+
+    fix = Fixture_state("-", "./tmp/windows.streamed.psql");
+    Fixture_run_piped(fix, "./tmp/windows.psql");
+    assert_int_equal(fix->fixed, 16);
+    Fixture_free(fix);
+    Fixture_assert_same("./tmp/windows.streamed.psql", "./tmp/windows.fixed.psql");
+
+    free(whole);
+    free(dump);
+    free(fixed);
+}
+
+/**
+ * Stages of streamed input run on their own threads with more than one job
+ * and take turns with one, either way output is the same.
+ */
+void test_simple_streamed_pipeline(void **state) {
+    Fixture_large("./tmp/pipeline.psql", "./tmp/pipeline.fixed.psql", 3, 2 << 20);
+    const size_t jobs[] = {1, 4};
+    for (size_t i = 0; i < sizeof(jobs) / sizeof(jobs[0]); i++) {
+        State *fix = Fixture_state("-", "./tmp/pipeline.out.psql");
+        fix->jobs = jobs[i];
+        Fixture_run_piped(fix, "./tmp/pipeline.psql");
+        assert_int_equal(fix->fixed, 4 * 7);
+        Fixture_free(fix);
+        Fixture_assert_same("./tmp/pipeline.out.psql", "./tmp/pipeline.fixed.psql");
+    }
+
+    // compressed regular file is streamed through the same stages
+    if (!Output_supports(OutputFormat_Gzip))
+        return;
+    Fixture_compress("./tmp/pipeline.psql", "./tmp/pipeline.psql.gz", OutputFormat_Gzip);
+    State *fix = Fixture_state("./tmp/pipeline.psql.gz", "./tmp/pipeline.out.psql");
+    fix->jobs = 4;
+    Fixture_run(fix);
+    assert_int_equal(fix->fixed, 4 * 7);
+    Fixture_free(fix);
+    Fixture_assert_same("./tmp/pipeline.out.psql", "./tmp/pipeline.fixed.psql");
+}
+
+/**
+ * With `--compact` file is rewritten within itself, it keeps its inode and
+ * no journal is left once done.
+ */
+void test_simple_in_place_compacted(void **state) {
+    struct stat before, after;
+    Fixture_large("./tmp/compact.psql", "./tmp/compact.fixed.psql", 3, 2 << 20);
+    assert_int_equal(stat("./tmp/compact.psql", &before), 0);
+
+    State *fix = Fixture_state("./tmp/compact.psql", "./tmp/compact.psql");
+    fix->compact = 1;
+    Fixture_run(fix);
+    assert_int_equal(fix->fixed, 4 * 7);
+    Fixture_free(fix);
+
+    assert_int_equal(stat("./tmp/compact.psql", &after), 0);
+    assert_int_equal(after.st_ino, before.st_ino);
+    assert_int_equal(access("./tmp/compact.psql.journal", F_OK), -1);
+    Fixture_assert_same("./tmp/compact.psql", "./tmp/compact.fixed.psql");
+}
+
+/**
+ * Compaction interrupted after its output reached past the first COPY block
+ * leaves stale bytes between write and read cursor, resumed one continues
+ * from the checkpoint.
+ */
+void test_simple_in_place_compact_resume(void **state) {
+    Fixture_large("./tmp/compact_resume.psql", "./tmp/compact_resume.fixed.psql", 2, 1 << 20);
+    size_t size, expected_size;
+    char *data = Fixture_load("./tmp/compact_resume.psql", &size);
+    char *expected = Fixture_load("./tmp/compact_resume.fixed.psql", &expected_size);
+    const char *terminator = strstr(strstr(data, "COPY public.big"), "\n\\.\n");
+    assert_non_null(terminator);
+    size_t in_offset = (size_t) (terminator - data) + 4;
+
+    State *fix = Fixture_state("./tmp/compact_resume.psql", "./tmp/compact_resume.psql");
+    char *prefix = (char *) malloc(in_offset);
+    memcpy(prefix, data, in_offset);
+    size_t out_offset = fix_string(fix, prefix, in_offset, 0);
+    assert_memory_equal(prefix, expected, out_offset);
+    free(prefix);
+
+    FILE *file = fopen("./tmp/compact_resume.psql", "r+");
+    assert_non_null(file);
+    assert_int_equal(fwrite(expected, 1, out_offset, file), out_offset);
+    assert_int_equal(fclose(file), 0);
+
+    struct stat in_stat;
+    assert_int_equal(stat("./tmp/compact_resume.psql", &in_stat), 0);
+    Journal *journal = Journal_init("./tmp/compact_resume.psql", &in_stat);
+    journal->backupCap = FIXPQ_WINDOW_SIZE;
+    assert_int_equal(Journal_save_shift(journal, in_offset, out_offset, 0, 0, NULL, 0), 0);
+    Journal_free(journal, 0);
+
+    fix->fixed = 0;
+    fix->resume = 1;
+    Fixture_run(fix);
+    assert_int_equal(fix->fixed, 2 * 7);
+    Fixture_free(fix);
+
+    assert_int_equal(access("./tmp/compact_resume.psql.journal", F_OK), -1);
+    Fixture_assert_same("./tmp/compact_resume.psql", "./tmp/compact_resume.fixed.psql");
+    free(data);
+    free(expected);
+}
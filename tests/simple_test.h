@@ -0,0 +1,37 @@
+#pragma once
+
+#include <types.h>
+
+void test_simple_mapped_dump(void **state);
+
+void test_simple_mapped_unchanged(void **state);
+
+void test_simple_streamed_dump(void **state);
+
+void test_simple_in_place_staged(void **state);
+
+void test_simple_in_place_unchanged(void **state);
+
+void test_simple_compressed_input(void **state);
+
+void test_simple_compressed_output(void **state);
+
+void test_simple_candidate_alignment(void **state);
+
+void test_simple_rules_single_pass(void **state);
+
+void test_simple_blocks_regular_file(void **state);
+
+void test_simple_parallel_chunks(void **state);
+
+void test_simple_copy_passthrough(void **state);
+
+void test_simple_dry_report(void **state);
+
+void test_simple_windows(void **state);
+
+void test_simple_streamed_pipeline(void **state);
+
+void test_simple_in_place_compacted(void **state);
+
+void test_simple_in_place_compact_resume(void **state);
@@ -0,0 +1,91 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmocka.h>
+
+#include <types.h>
+#include <slice.h>
+#include <fixture.h>
+#include <slice_test.h>
+
+#define SLICE_MAX 4
+
+static void merge_ranges(const char *input, const size_t *cuts, size_t len, const char *merged);
+
+/**
+ * Ranges cut inside COPY data and in the middle of a line, merged slices
+ * are byte for byte the serial conversion.
+ */
+void test_slice_merge_ranges(void **state) {
+    Fixture_large("./tmp/slice.psql", "./tmp/slice.fixed.psql", 3, 1 << 20);
+    State *fix = Fixture_state("./tmp/slice.psql", "./tmp/slice.serial.psql");
+    Fixture_run(fix);
+    Fixture_free(fix);
+
+    const size_t cuts[] = {0, 500000, 1100007, 2600000};
+    merge_ranges("./tmp/slice.psql", cuts, sizeof(cuts) / sizeof(cuts[0]), "./tmp/slice.merged.psql");
+    Fixture_assert_same("./tmp/slice.merged.psql", "./tmp/slice.serial.psql");
+    Fixture_assert_same("./tmp/slice.merged.psql", "./tmp/slice.fixed.psql");
+}
+
+/**
+ * COPY data row looking exactly like a header makes slice starting before
+ * it guess it's outside COPY data, merge converts that slice again.
+ */
+void test_slice_merge_wrong_guess(void **state) {
+    size_t dump_size, fixed_size;
+    char *dump = Fixture_load("./examples/dump.psql", &dump_size);
+    char *fixed = Fixture_load("./examples/dump.fixed.psql", &fixed_size);
+    FILE *file = fopen("./tmp/slice_guess.psql", "w");
+    FILE *expected = fopen("./tmp/slice_guess.fixed.psql", "w");
+    assert_non_null(file);
+    assert_non_null(expected);
+    for (short i = 0; i < 2; i++) {
+        FILE *to = i ? expected : file;
+        fwrite(i ? fixed : dump, 1, i ? fixed_size : dump_size, to);
+        fputs("COPY public.t (a) FROM stdin;\n", to);
+        for (size_t row = 0; row < 1000; row++) fputs("    AS integer\n", to);
+        fputs("COPY public.u (a) FROM stdin;\n", to);
+        for (size_t row = 0; row < 1000; row++) fputs("    AS integer\n", to);
+        fputs("\\.\n", to);
+        fwrite(i ? fixed : dump, 1, i ? fixed_size : dump_size, to);
+    }
+    assert_int_equal(fclose(file), 0);
+    assert_int_equal(fclose(expected), 0);
+
+    const size_t cuts[] = {0, dump_size + 7500};
+    merge_ranges("./tmp/slice_guess.psql", cuts, sizeof(cuts) / sizeof(cuts[0]), "./tmp/slice_guess.merged.psql");
+    Fixture_assert_same("./tmp/slice_guess.merged.psql", "./tmp/slice_guess.fixed.psql");
+    free(dump);
+    free(fixed);
+}
+
+/**
+ * Convert ranges starting at `cuts`, the last one reaching end of input,
+ * and merge their slices into `merged` listed in reverse order.
+ */
+static void merge_ranges(const char *input, const size_t *cuts, size_t len, const char *merged) {
+    char paths[SLICE_MAX][64];
+    char *parts[SLICE_MAX];
+    assert_true(len <= SLICE_MAX);
+    for (size_t i = 0; i < len; i++) {
+        snprintf(paths[i], sizeof(paths[i]), "./tmp/slice.part%zu.psql", i);
+        State *fix = Fixture_state(input, paths[i]);
+        fix->ranged = 1;
+        fix->rangeStart = cuts[i];
+        fix->rangeLen = i + 1 < len ? cuts[i + 1] - cuts[i] : (size_t) -1 - cuts[i];
+        Fixture_run(fix);
+        Fixture_free(fix);
+        parts[len - 1 - i] = paths[i];
+    }
+
+    State *fix = Fixture_state("-", merged);
+    fix->merge = 1;
+    fix->parts = parts;
+    fix->partLen = len;
+    merge_slices(fix);
+    fix->parts = NULL;
+    Fixture_free(fix);
+}
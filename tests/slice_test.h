@@ -0,0 +1,7 @@
+#pragma once
+
+#include <types.h>
+
+void test_slice_merge_ranges(void **state);
+
+void test_slice_merge_wrong_guess(void **state);